@@ -0,0 +1,378 @@
+#include "AllocationTracker.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#if ALLOCATION_TRACKING && defined(_MSC_VER)
+#include <windows.h>
+#include <DbgHelp.h>
+#pragma comment(lib, "dbghelp.lib")
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define RETURN_ADDRESS() _ReturnAddress()
+#else
+#define RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+namespace {
+	FILE* OpenForWrite(const char* path) {
+#ifdef _MSC_VER
+		FILE* fp = nullptr;
+		if (fopen_s(&fp, path, "w") != 0) return nullptr;
+		return fp;
+#else
+		return std::fopen(path, "w");
+#endif
+	}
+}
+
+#if ALLOCATION_TRACKING
+namespace {
+	const int SITE_TABLE_SIZE = 2048;	// 2ׂ̂Bꂽ͍Ō1ɂ܂Ƃ߂
+	const int SKIP_FRAMES = 2;			// TrackedAlloc  operator new g͋L^Ȃ
+
+	std::atomic<unsigned long long> g_totalCount{ 0 };
+	std::atomic<unsigned int> g_frameCount{ 0 };
+	std::atomic<unsigned long long> g_frameBytes{ 0 };
+	std::atomic<unsigned int> g_frameNumber{ 0 };
+
+	// ȉׂ͂ g_mutex Ŏ
+	std::mutex g_mutex;
+	AllocationTracker::FrameStats g_history[AllocationTracker::HISTORY_SIZE];
+	int g_historyHead = 0;
+	int g_historyCount = 0;
+	AllocationTracker::CallSite g_sites[SITE_TABLE_SIZE];
+	unsigned long long g_siteHashes[SITE_TABLE_SIZE];	// 0 ͋
+	int g_siteCount = 0;
+
+	// L^̏̒Ńq[vgƂ (DbgHelp Ȃ) ɁA𐔂Ȃ߂̈
+	thread_local bool t_suppress = false;
+
+	struct SuppressScope {
+		bool previous;
+		SuppressScope() : previous(t_suppress) { t_suppress = true; }
+		~SuppressScope() { t_suppress = previous; }
+	};
+
+	// caller  operator new ̖߂BX^bNHȂł͂ꂾg
+	int CaptureStack(void** stack, void* caller) {
+#ifdef _MSC_VER
+		(void)caller;
+		return CaptureStackBackTrace(SKIP_FRAMES, AllocationTracker::MAX_STACK_DEPTH, stack, nullptr);
+#else
+		// backtrace ͂ꎩ̂q[vgƂ̂ŎgȂ
+		stack[0] = caller;
+		return 1;
+#endif
+	}
+
+	unsigned long long HashStack(void* const* stack, int depth) {
+		// FNV-1a
+		unsigned long long h = 1469598103934665603ull;
+		for (int i = 0; i < depth; i++) {
+			h ^= (unsigned long long)(std::uintptr_t)stack[i];
+			h *= 1099511628211ull;
+		}
+		return h ? h : 1;
+	}
+
+	void RecordSite(std::size_t size, void* caller) {
+		void* stack[AllocationTracker::MAX_STACK_DEPTH];
+		const int depth = CaptureStack(stack, caller);
+		const unsigned long long hash = HashStack(stack, depth);
+
+		std::lock_guard<std::mutex> lock(g_mutex);
+		int index = (int)(hash & (SITE_TABLE_SIZE - 1));
+		for (int probe = 0; probe < SITE_TABLE_SIZE; probe++) {
+			if (g_siteHashes[index] == hash) break;
+			if (g_siteHashes[index] == 0) {
+				// Ō1͈ꂽ̎󂯎MƂĎc
+				if (g_siteCount >= SITE_TABLE_SIZE - 1) {
+					index = SITE_TABLE_SIZE - 1;
+					break;
+				}
+				g_siteHashes[index] = hash;
+				AllocationTracker::CallSite& site = g_sites[index];
+				site = {};
+				site.depth = depth;
+				std::memcpy(site.stack, stack, sizeof(void*) * depth);
+				g_siteCount++;
+				break;
+			}
+			index = (index + 1) & (SITE_TABLE_SIZE - 1);
+		}
+		AllocationTracker::CallSite& site = g_sites[index];
+		site.count++;
+		site.bytes += size;
+		site.lastFrame = g_frameNumber.load(std::memory_order_relaxed);
+	}
+
+	void Record(std::size_t size, void* caller) {
+		g_totalCount.fetch_add(1, std::memory_order_relaxed);
+		if (t_suppress) return;
+		g_frameCount.fetch_add(1, std::memory_order_relaxed);
+		g_frameBytes.fetch_add(size, std::memory_order_relaxed);
+		SuppressScope suppress;
+		RecordSite(size, caller);
+	}
+
+	void* TrackedAlloc(std::size_t size, void* caller) {
+		Record(size, caller);
+		void* p = std::malloc(size ? size : 1);
+		if (!p) throw std::bad_alloc();
+		return p;
+	}
+
+	void* TrackedAllocNoThrow(std::size_t size, void* caller) noexcept {
+		try {
+			Record(size, caller);
+		}
+		catch (...) {
+			// L^ɎsĂmۂ͂
+		}
+		return std::malloc(size ? size : 1);
+	}
+
+	void* AlignedMalloc(std::size_t size, std::size_t alignment) noexcept {
+		if (size == 0) size = 1;
+#ifdef _MSC_VER
+		return _aligned_malloc(size, alignment);
+#else
+		// aligned_alloc ̓TCYACg̔{łȂ΂ȂȂ
+		if (alignment < sizeof(void*)) alignment = sizeof(void*);
+		size = (size + alignment - 1) & ~(alignment - 1);
+		return std::aligned_alloc(alignment, size);
+#endif
+	}
+
+	void AlignedFree(void* p) noexcept {
+#ifdef _MSC_VER
+		_aligned_free(p);
+#else
+		std::free(p);
+#endif
+	}
+
+	void* TrackedAlignedAlloc(std::size_t size, std::size_t alignment, void* caller) {
+		Record(size, caller);
+		void* p = AlignedMalloc(size, alignment);
+		if (!p) throw std::bad_alloc();
+		return p;
+	}
+
+	void* TrackedAlignedAllocNoThrow(std::size_t size, std::size_t alignment, void* caller) noexcept {
+		try {
+			Record(size, caller);
+		}
+		catch (...) {
+			// L^ɎsĂmۂ͂
+		}
+		return AlignedMalloc(size, alignment);
+	}
+}
+
+// ʏ new / delete u
+void* operator new(std::size_t size) { return TrackedAlloc(size, RETURN_ADDRESS()); }
+void* operator new[](std::size_t size) { return TrackedAlloc(size, RETURN_ADDRESS()); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return TrackedAllocNoThrow(size, RETURN_ADDRESS()); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return TrackedAllocNoThrow(size, RETURN_ADDRESS()); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+// ACgw (AlignedAllocator oR FloatArray Ȃ) L^
+void* operator new(std::size_t size, std::align_val_t al) { return TrackedAlignedAlloc(size, (std::size_t)al, RETURN_ADDRESS()); }
+void* operator new[](std::size_t size, std::align_val_t al) { return TrackedAlignedAlloc(size, (std::size_t)al, RETURN_ADDRESS()); }
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return TrackedAlignedAllocNoThrow(size, (std::size_t)al, RETURN_ADDRESS()); }
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return TrackedAlignedAllocNoThrow(size, (std::size_t)al, RETURN_ADDRESS()); }
+void operator delete(void* p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { AlignedFree(p); }
+
+bool AllocationTracker::Enabled() { return true; }
+
+void AllocationTracker::BeginFrame() {
+	g_frameCount.store(0, std::memory_order_relaxed);
+	g_frameBytes.store(0, std::memory_order_relaxed);
+}
+
+void AllocationTracker::EndFrame() {
+	const FrameStats stats = CurrentFrame();
+	std::lock_guard<std::mutex> lock(g_mutex);
+	g_history[g_historyHead] = stats;
+	g_historyHead = (g_historyHead + 1) % HISTORY_SIZE;
+	if (g_historyCount < HISTORY_SIZE) g_historyCount++;
+	g_frameNumber.fetch_add(1, std::memory_order_relaxed);
+}
+
+unsigned int AllocationTracker::FrameNumber() { return g_frameNumber.load(std::memory_order_relaxed); }
+
+unsigned long long AllocationTracker::TotalCount() { return g_totalCount.load(std::memory_order_relaxed); }
+
+AllocationTracker::FrameStats AllocationTracker::CurrentFrame() {
+	return { g_frameCount.load(std::memory_order_relaxed), g_frameBytes.load(std::memory_order_relaxed) };
+}
+
+AllocationTracker::FrameStats AllocationTracker::LastFrame() {
+	std::lock_guard<std::mutex> lock(g_mutex);
+	if (g_historyCount == 0) return { 0, 0 };
+	return g_history[(g_historyHead + HISTORY_SIZE - 1) % HISTORY_SIZE];
+}
+
+int AllocationTracker::FrameHistory(FrameStats* out, int maxCount) {
+	std::lock_guard<std::mutex> lock(g_mutex);
+	const int n = std::min(maxCount, g_historyCount);
+	const int start = (g_historyHead + HISTORY_SIZE - n) % HISTORY_SIZE;
+	for (int i = 0; i < n; i++) {
+		out[i] = g_history[(start + i) % HISTORY_SIZE];
+	}
+	return n;
+}
+
+int AllocationTracker::TopCallSites(CallSite* out, int maxCount, unsigned int sinceFrame) {
+	if (maxCount <= 0) return 0;
+	std::lock_guard<std::mutex> lock(g_mutex);
+	//  maxCount }\[gŎc (\ۂƃRs[Ȃ)
+	int n = 0;
+	for (int i = 0; i < SITE_TABLE_SIZE; i++) {
+		const CallSite& site = g_sites[i];
+		if (site.count == 0 || site.lastFrame < sinceFrame) continue;
+		if (n == maxCount && site.count <= out[n - 1].count) continue;
+		int j = (n < maxCount) ? n++ : n - 1;
+		while (j > 0 && out[j - 1].count < site.count) {
+			out[j] = out[j - 1];
+			j--;
+		}
+		out[j] = site;
+	}
+	return n;
+}
+
+void AllocationTracker::DescribeCallSite(const CallSite& site, char* buffer, int bufferSize) {
+	if (bufferSize <= 0) return;
+	buffer[0] = '\0';
+	if (site.depth == 0) {
+		std::snprintf(buffer, bufferSize, "(s)");
+		return;
+	}
+	SuppressScope suppress;
+#ifdef _MSC_VER
+	static bool symInitialized = false;
+	HANDLE process = GetCurrentProcess();
+	std::lock_guard<std::mutex> lock(g_mutex);
+	if (!symInitialized) {
+		SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES);
+		symInitialized = SymInitialize(process, nullptr, TRUE) != FALSE;
+	}
+	if (symInitialized) {
+		alignas(SYMBOL_INFO) char symbolBuffer[sizeof(SYMBOL_INFO) + MAX_SYM_NAME];
+		SYMBOL_INFO* symbol = (SYMBOL_INFO*)symbolBuffer;
+		for (int i = 0; i < site.depth; i++) {
+			std::memset(symbolBuffer, 0, sizeof(symbolBuffer));
+			symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+			symbol->MaxNameLen = MAX_SYM_NAME;
+			DWORD64 address = (DWORD64)site.stack[i];
+			if (!SymFromAddr(process, address, nullptr, symbol)) continue;
+			// WCu̒ (vector ̐LȂ) ł͂ȂAĂ񂾎̃R[h
+			const char* name = symbol->Name;
+			if (std::strncmp(name, "std::", 5) == 0 || std::strncmp(name, "operator new", 12) == 0) continue;
+
+			IMAGEHLP_LINE64 line = {};
+			line.SizeOfStruct = sizeof(line);
+			DWORD displacement = 0;
+			if (SymGetLineFromAddr64(process, address, &displacement, &line)) {
+				const char* file = std::strrchr(line.FileName, '\\');
+				std::snprintf(buffer, bufferSize, "%s (%s:%lu)", name, file ? file + 1 : line.FileName, line.LineNumber);
+			}
+			else {
+				std::snprintf(buffer, bufferSize, "%s", name);
+			}
+			return;
+		}
+	}
+#endif
+	std::snprintf(buffer, bufferSize, "%p", site.stack[0]);
+}
+
+bool AllocationTracker::WriteCallSitesCsv(const char* path) {
+	SuppressScope suppress;
+	FILE* fp = OpenForWrite(path);
+	if (!fp) return false;
+	static CallSite sites[SITE_TABLE_SIZE];
+	const int n = TopCallSites(sites, SITE_TABLE_SIZE);
+	std::fprintf(fp, "count,bytes,last_frame,site\n");
+	char description[512];
+	for (int i = 0; i < n; i++) {
+		DescribeCallSite(sites[i], description, sizeof(description));
+		// ֐ɂ̓J} (ev[g) ̂ňpň͂
+		std::fprintf(fp, "%llu,%llu,%u,\"%s\"\n", sites[i].count, sites[i].bytes, sites[i].lastFrame, description);
+	}
+	std::fclose(fp);
+	return true;
+}
+
+bool AllocationTracker::WriteFramesCsv(const char* path) {
+	SuppressScope suppress;
+	FILE* fp = OpenForWrite(path);
+	if (!fp) return false;
+	static FrameStats history[HISTORY_SIZE];
+	const int n = FrameHistory(history, HISTORY_SIZE);
+	const unsigned int firstFrame = FrameNumber() - n;
+	std::fprintf(fp, "frame,count,bytes\n");
+	for (int i = 0; i < n; i++) {
+		std::fprintf(fp, "%u,%u,%llu\n", firstFrame + i, history[i].count, history[i].bytes);
+	}
+	std::fclose(fp);
+	return true;
+}
+
+void AllocationTracker::Reset() {
+	std::lock_guard<std::mutex> lock(g_mutex);
+	std::memset(g_siteHashes, 0, sizeof(g_siteHashes));
+	std::memset(g_sites, 0, sizeof(g_sites));
+	g_siteCount = 0;
+	g_historyHead = 0;
+	g_historyCount = 0;
+}
+#else
+bool AllocationTracker::Enabled() { return false; }
+void AllocationTracker::BeginFrame() {}
+void AllocationTracker::EndFrame() {}
+unsigned int AllocationTracker::FrameNumber() { return 0; }
+unsigned long long AllocationTracker::TotalCount() { return 0; }
+AllocationTracker::FrameStats AllocationTracker::CurrentFrame() { return { 0, 0 }; }
+AllocationTracker::FrameStats AllocationTracker::LastFrame() { return { 0, 0 }; }
+int AllocationTracker::FrameHistory(FrameStats*, int) { return 0; }
+int AllocationTracker::TopCallSites(CallSite*, int, unsigned int) { return 0; }
+void AllocationTracker::DescribeCallSite(const CallSite&, char* buffer, int bufferSize) {
+	if (bufferSize > 0) buffer[0] = '\0';
+}
+bool AllocationTracker::WriteCallSitesCsv(const char* path) {
+	FILE* fp = OpenForWrite(path);
+	if (!fp) return false;
+	std::fprintf(fp, "count,bytes,last_frame,site\n");
+	std::fclose(fp);
+	return true;
+}
+bool AllocationTracker::WriteFramesCsv(const char* path) {
+	FILE* fp = OpenForWrite(path);
+	if (!fp) return false;
+	std::fprintf(fp, "frame,count,bytes\n");
+	std::fclose(fp);
+	return true;
+}
+void AllocationTracker::Reset() {}
+#endif
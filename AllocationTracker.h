@@ -0,0 +1,65 @@
+#pragma once
+
+// ALLOCATION_TRACKING  1 ̂ƂAO[o operator new / delete u
+// q[vmۂt[ƁEĂяo (R[X^bN) ƂɋL^B
+// ł̓fobOrhLB[XŌvƂ̓vWFNg ALLOCATION_TRACKING=1 `
+#ifndef ALLOCATION_TRACKING
+#ifdef _DEBUG
+#define ALLOCATION_TRACKING 1
+#else
+#define ALLOCATION_TRACKING 0
+#endif
+#endif
+
+// q[vmۂ̋L^ (GameManager t[̋؂`AI[o[C CSV ŊmF)
+// L^̃tbN̓q[vgȂ (ŒTCY̕\ɏ) ̂ŁAǂ̃Xbh̊mۂ
+class AllocationTracker {
+public:
+	// 1t[̏Wv
+	struct FrameStats {
+		unsigned int count;			// operator new ̉
+		unsigned long long bytes;	// mۂoCg
+	};
+
+	// Ăяo1̏Wv
+	static const int MAX_STACK_DEPTH = 12;
+	struct CallSite {
+		unsigned long long count;
+		unsigned long long bytes;
+		unsigned int lastFrame;		// ŌɊmۂt[ԍ
+		int depth;
+		void* stack[MAX_STACK_DEPTH];	// operator new Ă񂾂Ƃ납O
+	};
+
+	// tbNL (ALLOCATION_TRACKING  1 Ȃ true)
+	static bool Enabled();
+
+	// t[̋؂BEndFrame ō̃t[̏Wv𗚗ɐς
+	static void BeginFrame();
+	static void EndFrame();
+	// ܂łɏIt[̐
+	static unsigned int FrameNumber();
+
+	// NĂ operator new ̉ (SXbhv)
+	static unsigned long long TotalCount();
+	// ̃t[ł܂ł̏WvƁAOɏIt[̏Wv
+	static FrameStats CurrentFrame();
+	static FrameStats LastFrame();
+	// ߂̃t[̏WvÂ out ֏ (Ԃ)BHISTORY_SIZE t[܂Ŏc
+	static const int HISTORY_SIZE = 300;
+	static int FrameHistory(FrameStats* out, int maxCount);
+
+	// 񐔂̑ɌĂяo out ֏ (Ԃ)
+	// sinceFrame ȍ~ɊmۂĂяoΏۂɂ
+	static int TopCallSites(CallSite* out, int maxCount, unsigned int sinceFrame = 0);
+	// Ăяo̍ŏ́ũR[hv(std::  operator new łȂ֐) 
+	// "֐ (t@C:s)" ̌` buffer ɏ (V{Ȃ΃AhX)
+	static void DescribeCallSite(const CallSite& site, char* buffer, int bufferSize);
+
+	// ĂяoƂ̏Wvƃt[̗ CSV ɏo
+	static bool WriteCallSitesCsv(const char* path);
+	static bool WriteFramesCsv(const char* path);
+
+	// L^ (vԂ蒼Ƃ)
+	static void Reset();
+};
@@ -0,0 +1,136 @@
+#include "FramePacer.h"
+#include <chrono>
+#include <thread>
+
+#ifdef _MSC_VER
+#include <Windows.h>
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
+namespace {
+	//đ҂͈̔ (肷ʂ傫ł́A҂Ԃ̂قƂǂ)
+	const LONGLONG MIN_SPIN_US = 500;
+	const LONGLONG MAX_SPIN_US = 20000;
+	//肷ʂɂꂾ]T𑫂
+	const LONGLONG SPIN_MARGIN_US = 300;
+
+	int Bucket(LONGLONG frameUs) {
+		const LONGLONG bucket = frameUs / FramePacer::BUCKET_US;
+		if (bucket < 0) return 0;
+		return bucket < FramePacer::BUCKET_COUNT ? (int)bucket : FramePacer::BUCKET_COUNT - 1;
+	}
+}
+
+FramePacer::FramePacer() {
+#ifdef _MSC_VER
+	//Sleep ̕\ 1ms ɂ ( 15.6ms ł͒ߐ؂̎OŖȂ)
+	timeBeginPeriod(1);
+#endif
+}
+
+FramePacer::~FramePacer() {
+#ifdef _MSC_VER
+	timeEndPeriod(1);
+#endif
+}
+
+void FramePacer::SetTargetRate(int rate) {
+	m_targetRate = rate > 0 ? rate : 0;
+	m_periodUs = m_targetRate > 0 ? 1000000 / m_targetRate : 0;
+	//̒ߐ؂͎ɑ҂Ƃɍ猈ߒ
+	m_deadline = 0;
+}
+
+void FramePacer::WaitForNextFrame() {
+	LONGLONG now = GetNowHiPerformanceCount();
+	if (m_periodUs > 0) {
+		if (m_deadline == 0 || now - m_deadline > m_periodUs) {
+			//ŏ̃t[A1t[ȏxꂽƂ͒ǂƂAn߂č獏ݒ
+			if (m_deadline != 0) m_missed++;
+			m_deadline = now;
+		}
+		else if (now > m_deadline) {
+			//xꂽȂ҂Ɏ (ߐ؂͍݂̂܂ܐi߂)
+			m_missed++;
+		}
+
+		//ߐ؂ spin O܂ł͖
+		const LONGLONG wakeAt = m_deadline - m_spinUs;
+		if (now < wakeAt) {
+			std::this_thread::sleep_for(std::chrono::microseconds(wakeAt - now));
+			now = GetNowHiPerformanceCount();
+			//肷ʂɍ킹ĉ镝߂ (L̂͂Ak߂̂͂)
+			const LONGLONG wanted = (now - wakeAt) + SPIN_MARGIN_US;
+			m_spinUs = (wanted > m_spinUs) ? wanted : m_spinUs - (m_spinUs - wanted) / 16;
+			if (m_spinUs < MIN_SPIN_US) m_spinUs = MIN_SPIN_US;
+			if (m_spinUs > MAX_SPIN_US) m_spinUs = MAX_SPIN_US;
+		}
+		//c͎vȂ (̃Xbhɂ͏)
+		while (now < m_deadline) {
+			std::this_thread::yield();
+			now = GetNowHiPerformanceCount();
+		}
+		m_deadline += m_periodUs;
+	}
+
+	if (m_frameBegin != 0) Record(now - m_frameBegin);
+	m_frameBegin = now;
+}
+
+void FramePacer::Record(LONGLONG frameUs) {
+	//ςȂԌÂt[WvO
+	if (m_historyCount == HISTORY_FRAMES) {
+		const int oldest = m_history[m_historyIndex];
+		m_histogram[Bucket(oldest)]--;
+		m_historySumUs -= oldest;
+	}
+	else {
+		m_historyCount++;
+	}
+	m_history[m_historyIndex] = (int)frameUs;
+	m_historyIndex = (m_historyIndex + 1) % HISTORY_FRAMES;
+	m_histogram[Bucket(frameUs)]++;
+	m_historySumUs += frameUs;
+}
+
+FramePacer::Stats FramePacer::GetStats() const {
+	Stats stats = {};
+	stats.frames = m_historyCount;
+	stats.missed = m_missed;
+	stats.spinMs = m_spinUs / 1000.0f;
+	if (m_historyCount == 0) return stats;
+
+	const double averageUs = (double)m_historySumUs / m_historyCount;
+	const double targetUs = m_periodUs > 0 ? (double)m_periodUs : averageUs;
+	double deviationUs = 0;
+	int maxUs = 0;
+	for (int i = 0; i < m_historyCount; i++) {
+		const int frameUs = m_history[i];
+		deviationUs += frameUs > targetUs ? frameUs - targetUs : targetUs - frameUs;
+		if (frameUs > maxUs) maxUs = frameUs;
+	}
+	stats.averageMs = (float)(averageUs / 1000.0);
+	stats.jitterMs = (float)(deviationUs / m_historyCount / 1000.0);
+	stats.maxMs = maxUs / 1000.0f;
+
+	//p[Z^C̓qXgŐԂ̐^񒆂ő\
+	const int p50Rank = (m_historyCount - 1) / 2;
+	const int p99Rank = (m_historyCount - 1) * 99 / 100;
+	int seen = 0;
+	stats.p50Ms = -1.0f;
+	for (int b = 0; b < BUCKET_COUNT; b++) {
+		seen += m_histogram[b];
+		const float ms = (b + 0.5f) * BUCKET_US / 1000.0f;
+		if (stats.p50Ms < 0 && seen > p50Rank) stats.p50Ms = ms;
+		if (seen > p99Rank) {
+			stats.p99Ms = ms;
+			break;
+		}
+	}
+	return stats;
+}
+
+void FramePacer::Histogram(int* out) const {
+	for (int b = 0; b < BUCKET_COUNT; b++) out[b] = m_histogram[b];
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "DxLib.h"
+
+// t[̊ԊuڕW̃t[[gɍ킹
+// ߐ؂̏O܂ł͖ (CPU gȂ)Ac͍\̎vȂđ҂B
+// 肷ʂoĂAđ҂ɍ킹čLk߂B
+// t[̎ (O WaitForNextFrame 獡܂) ͒ HISTORY_FRAMES qXgOɏWv
+class FramePacer {
+public:
+	// qXgO1Ԃ̕ƋԂ̐ (Ō̋Ԃ͂蒷t[ׂ)
+	static const int BUCKET_US = 100;
+	static const int BUCKET_COUNT = 400;
+	static const int HISTORY_FRAMES = 600;
+
+	struct Stats {
+		int frames;			// Wvt[
+		float averageMs;
+		float p50Ms;
+		float p99Ms;
+		float maxMs;
+		float jitterMs;		// ڕW̊Ԋû̕ (ڕWȂƂ͕ς̂)
+		int missed;			// ߐ؂ɊԂɍȂt[ (NĂ̍v)
+		float spinMs;		// ܉đ҂Ă镝
+	};
+
+	FramePacer();
+	~FramePacer();
+
+	FramePacer(const FramePacer&) = delete;
+	FramePacer& operator=(const FramePacer&) = delete;
+
+	// rate /bŃt[ (0 ȉȂ҂ɎԂ)
+	void SetTargetRate(int rate);
+	int TargetRate() const { return m_targetRate; }
+
+	// t[̍Ō (ScreenFlip ̌) ɌĂԁB̃t[̒ߐ؂܂ő҂
+	void WaitForNextFrame();
+
+	Stats GetStats() const;
+	//  HISTORY_FRAMES ̃qXgO (out  BUCKET_COUNT )
+	void Histogram(int* out) const;
+
+private:
+	void Record(LONGLONG frameUs);
+
+	int m_targetRate = 0;
+	LONGLONG m_periodUs = 0;
+	LONGLONG m_deadline = 0;		// ̃t[n߂鎞 (}CNb)
+	LONGLONG m_frameBegin = 0;		// ̃t[n߂
+	LONGLONG m_spinUs = 2000;		// ߐ؂̂ꂾO͖炸ɉ
+	int m_missed = 0;
+
+	int m_histogram[BUCKET_COUNT] = {};
+	int m_history[HISTORY_FRAMES] = {};		// t[̎ (}CNb)BÂ̂珇Ɏ̂Ă
+	int m_historyCount = 0;
+	int m_historyIndex = 0;
+	long long m_historySumUs = 0;
+};
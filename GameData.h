@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include "TextLayoutCache.h"
 
 class GameData {
 public:
@@ -15,6 +16,26 @@ public:
 	static const int windowWidth = 1280;
 	static const int windowHeight = 720;
 
+	// --- ̌ŒXebv ---
+	// ͕`̃t[[gɊ֌WȂ physicsRate /bŐi߂
+	static const int physicsRate = 60;
+	// 1t[Ői߂őXebv (ŒxꂪႾ܎ɑ̂h)
+	static const int maxSubSteps = 5;
+	// true Ȃ畨̌ŒXebv`Ƃ͕ʂ̃XbhŐi߂
+	// (͂̋L^EvĆAt[ƃXebv̑Ήۂ߃CXbhŐi߂)
+	static const bool threadedSimulation = true;
+	// true Ȃ琂؂AFramePacer  targetFrameRate Ńt[ (tbV[gvp)
+	static const bool uncappedFrameRate = false;
+	// ؂Ƃ̖ڕWt[[g (0 Ȃ琧Ȃ)
+	static const int targetFrameRate = 144;
+	// true Ȃ畨̐J[l SIMD gȂXJ[ɌŒ肷
+	// (xȂB͂L^ĂԂ́AɊ֌WȂXJ[ŉ)
+	static const bool deterministicPhysics = false;
+	// 1Xebvŕ̂̐̂ɎgĂ悢 (}CNbB0 Ȃ琧Ȃ)
+	// ̂͂̔ł߂̂ŁAdƂ͏_炩ȂɃt[тȂ
+	// (ԂŌʂς̂ŁAdeterministicPhysics ̂ƂƋL^EvC͎gȂ)
+	static const int solverBudgetUs = 0;
+
 	static int DrawStringWithAnchor(int x, int y, float rateX, float rateY, unsigned int Color, int fontHandle, const char* fmt, ...) {
 		// ψ
 		char buffer[1024];
@@ -23,13 +44,12 @@ public:
 		vsprintf_s(buffer, fmt, args);
 		va_end(args);
 
-		// ̃TCY擾
-		int strWidth = GetDrawStringWidthToHandle(buffer, -1, fontHandle);
-		int strHeight = GetFontSizeToHandle(fontHandle);
+		// ̃TCY擾 (͑Oɑlg)
+		const TextLayoutCache::Extent extent = TextLayoutCache::Measure(fontHandle, buffer);
 
 		// AJ[ʒul`W
-		int drawX = x - static_cast<int>(strWidth * rateX);
-		int drawY = y - static_cast<int>(strHeight * rateY);
+		int drawX = x - static_cast<int>(extent.width * rateX);
+		int drawY = y - static_cast<int>(extent.height * rateY);
 
 		// `
 		return DrawStringToHandle(drawX, drawY, buffer, Color, fontHandle);
@@ -51,18 +71,27 @@ public:
 		// όXg̏I
 		va_end(arg);
 
-		// ̕ƍ擾
-		int stringWidth = GetDrawStringWidth(strBuffer, strlen(strBuffer));
-		int stringHeight = GetFontSize();
+		// ̕ƍ擾 (E傫͑Oɑlg)
+		const TextLayoutCache::Extent extent = TextLayoutCache::Measure(TextLayoutCache::DEFAULT_FONT, strBuffer);
 
 		// AJ[ʒuɊÂĕ`WvZ
-		int drawX = x - static_cast<int>(stringWidth * rateX);
-		int drawY = y - static_cast<int>(stringHeight * rateY);
+		int drawX = x - static_cast<int>(extent.width * rateX);
+		int drawY = y - static_cast<int>(extent.height * rateY);
 
 		// DXCu̕`֐Ăяo
 		return DrawString(drawX, drawY, strBuffer, Color);
 	}
 
+	// ςȂAJ[ʒuɕ` (͎gȂ)
+	// ߂ĕ`Ƃɉ摜ɂĂA͂̉摜\邾ɂ
+	// fontHandle  TextLayoutCache::DEFAULT_FONT nƊ̃tHgŕ`
+	static int DrawStaticStringWithAnchor(int x, int y, float rateX, float rateY, unsigned int Color, int fontHandle, const char* text) {
+		const TextLayoutCache::Extent extent = TextLayoutCache::Measure(fontHandle, text);
+		int drawX = x - static_cast<int>(extent.width * rateX);
+		int drawY = y - static_cast<int>(extent.height * rateY);
+		return TextLayoutCache::DrawStatic(drawX, drawY, fontHandle, Color, text);
+	}
+
 private:
 	GameData() {}  // RXgN^ private 
 };
\ No newline at end of file
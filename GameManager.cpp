@@ -3,10 +3,24 @@
 #include "TitleState.h"
 #include "InGameState.h"
 #include "ResultState.h"
+#include "AllocationTracker.h"
+#include "PhysicsCore/Profiler.h"
+#include "PhysicsCore/SimdSupport.h"
+#include "PhysicsCore/WorldSnapshot.h"
+#include <cassert>
+
+namespace {
+	//V[ςĂ炱̃t[̊Ԃ́Aobt@̂Ńq[vmۂ
+	const int STEADY_STATE_FRAMES = 120;
+	//I[o[CɏoĂяo̐
+	const int OVERLAY_SITE_COUNT = 8;
+	//vt@C̃I[o[CɏoԂ̐
+	const int OVERLAY_ZONE_COUNT = 32;
+	const int OVERLAY_COUNTER_COUNT = 8;
+	const int OVERLAY_FLAME_EVENTS = 1024;
+}
 
 GameManager::GameManager() :m_isGameFinished(false) {
-	memset(m_inputState.key, 0, sizeof(m_inputState.key));
-	memset(m_inputState.prevKey, 0, sizeof(m_inputState.prevKey));
 }
 
 GameManager::~GameManager() {
@@ -14,86 +28,538 @@ GameManager::~GameManager() {
 }
 
 void GameManager::Initialize() {
+	if (GameData::uncappedFrameRate) {
+		//҂Ȃ (DxLib_Init Oɐݒ肷Kv)
+		SetWaitVSyncFlag(FALSE);
+	}
 	if (DxLib_Init() == -1) {
 		return;
 	}
 	SetDrawScreen(DX_SCREEN_BACK);
+	//ő҂ȂƂ FramePacer ڕW̃t[[gɍ킹 (҂Ƃ͎Ԃ𑪂邾)
+	m_framePacer.SetTargetRate(GameData::uncappedFrameRate ? GameData::targetFrameRate : 0);
+	Profiler::SetThreadName("Main");
+	RegisterResources();
+	m_resources.Initialize();
+	if (GameData::deterministicPhysics) {
+		//SSE2 / AVX2  rsqrt  CPU ɂČʂႤ̂ŁAǂ PC łɂȂXJ[ŉ
+		SetSimdLevel(SimdLevel::Scalar);
+	}
 
 	//ChangeState(std::make_unique<TitleState>(this));
-	PushState(std::make_unique<TitleState>(this));
+	PushState(TakeScene(SceneId::Title));
 	currentState()->Init();
+	PreloadSuccessors();
 
-	m_prevTime = GetNowCount();
+	m_prevTime = GetNowHiPerformanceCount();
 }
 
 void GameManager::Update() {
+	AllocationTracker::BeginFrame();
+	Profiler::BeginFrame();
 	if (ProcessMessage() != 0) {
 		return;
 	}
 
-	UpdateInputState();
+	//œǂݍݏItHg摜g悤ɂ
+	m_resources.Update();
 
-	//deltaTiměvZ
-	float nowTime = GetNowCount();
-	float deltaTime = (nowTime - m_prevTime) / 1000.0f;
+	//Õt[̍Ɨp܂Ƃ߂Ď̂Ă
+	m_frameArena.Reset();
+	m_frameContext.arena = &m_frameArena;
+	m_frameContext.frameNumber++;
+
+	//vC̓O1t[ǂ (ǂݏI茳̓͂ɖ߂)
+	bool replaying = false;
+	if (m_player.IsOpen()) {
+		replaying = m_player.ReadFrame(m_logFrame);
+		if (!replaying) StopReplay();
+	}
+
+	//deltaTiměvZ (~bPʂ144HzȂǂŌ덷傫̂Ń}CNbő)
+	LONGLONG nowTime = GetNowHiPerformanceCount();
+	float deltaTime = (nowTime - m_prevTime) / 1000000.0f;
 	m_prevTime = nowTime;
+	//vCł͎vg킸AL^Ƃ̒lg
+	if (replaying) deltaTime = m_logFrame.deltaTime;
+	//̓Cxg̎ deltaTime ς񂾎vŕt (vCłɂȂ)
+	m_inputClock += deltaTime;
 
-	//SceneUpdate
-	SceneTransition* transition = m_currentState.top()->Update(&m_inputState, deltaTime);
-	if (transition->type == TransitionType::Change) {
-		m_currentState.top() = std::move(transition->nextState);
+	{
+		PROFILE_SCOPE("UpdateInputState");
+		UpdateInputState(replaying);
+	}
+
+	//L^EvC̓t[Ƃ̃Xebv𑵂邽߁ACXbhŐi߂
+	const bool threaded = GameData::threadedSimulation && !m_recorder.IsOpen() && !m_player.IsOpen();
+	if (threaded) {
+		m_simulation.SetKeys(m_logFrame.pressed);
+		m_simulation.Start();
+	}
+	else {
+		m_simulation.Stop();
+	}
+
+	//F1: mۂ̃I[o[C F2: ĂяoƂ̏Wv CSV ɏo
+	//F3: vt@C̃I[o[C F4: Chrome ̃g[Xo F5: t[Ԃ̃I[o[C
+	if (m_inputState.IsKeyDown(KEY_INPUT_F1)) {
+		m_showAllocationOverlay = !m_showAllocationOverlay;
+	}
+	if (m_inputState.IsKeyDown(KEY_INPUT_F2)) {
+		AllocationTracker::WriteCallSitesCsv("alloc_sites.csv");
+		AllocationTracker::WriteFramesCsv("alloc_frames.csv");
+	}
+	if (m_inputState.IsKeyDown(KEY_INPUT_F3)) {
+		m_showProfilerOverlay = !m_showProfilerOverlay;
+	}
+	if (m_inputState.IsKeyDown(KEY_INPUT_F4)) {
+		Profiler::WriteChromeTrace("profile_trace.json");
+	}
+	if (m_inputState.IsKeyDown(KEY_INPUT_F5)) {
+		m_showFramePacingOverlay = !m_showFramePacingOverlay;
+	}
+
+	//V[ Update ƑJڂ̊Ԃ́AV~[ṼXbh̃Xebv~߂Ă
+	std::unique_lock<std::mutex> pause;
+	if (threaded) pause = m_simulation.Pause();
+
+	//SceneUpdate (Jڂ͒lŎ󂯎̂ŁAJڂȂt[̓q[vgȂ)
+	SceneTransition transition;
+	{
+		PROFILE_SCOPE("Scene::Update");
+		transition = m_currentState.top()->Update(&m_inputState, deltaTime, m_frameContext);
+	}
+	if (transition.type != TransitionType::None) {
+		m_framesSinceTransition = 0;
+	}
+	if (transition.type == TransitionType::Change) {
+		//ǂ݂Ă΁Ał͓̂ւ Init 
+		PROFILE_SCOPE("Scene::Switch");
+		std::unique_ptr<IGameState> next = transition.nextState
+			? std::move(transition.nextState)
+			: TakeScene(transition.nextScene);
+		RetireScene(std::move(m_currentState.top()));
+		m_currentState.top() = std::move(next);
 		m_currentState.top()->Init();
 	}
-	else if (transition->type == TransitionType::Popup) {
-		PushState(std::move(transition->nextState));
+	else if (transition.type == TransitionType::Popup) {
+		PushState(std::move(transition.nextState));
 		currentState()->Init();
 	}
-	else if (transition->type == TransitionType::Resume) {
+	else if (transition.type == TransitionType::Resume) {
 		if (!m_currentState.empty())
 			PopState();
 		//Initialize͂ȂBʂɖ߂
 	}
+	if (transition.type != TransitionType::None) {
+		//VV[ Acquire IĂAǂ̃V[gȂȂ̂
+		m_resources.ReleaseUnused();
+		PreloadSuccessors();
+	}
+
+	if (threaded) {
+		//Xebv̓V~[ṼXbh̎vŐi߂
+		m_simulation.SetScene(currentState());
+		return;
+	}
+
+	//̃Xebv́AvCł͋L^񐔁AȊO͌oߎԂ猈߂
+	int steps;
+	if (replaying) {
+		steps = m_logFrame.steps;
+		m_interpolationAlpha = 1.0f;
+	}
+	else {
+		steps = ConsumeFixedSteps(deltaTime);
+	}
+	RunFixedSteps(steps);
+
+	RecordOrVerifyFrame(replaying, deltaTime, steps);
+}
+
+float GameManager::GetInterpolationAlpha(const WorldSnapshot& snapshot) const {
+	if (!m_simulation.IsRunning()) return m_interpolationAlpha;
+	//XibvVbg1XebvOƍ̏ԂĂ̂ŁAĂ1Xebv̎ԂőO֓
+	const float alpha = (Profiler::Now() - snapshot.PublishTime()) * 1e-9f * GameData::physicsRate;
+	return alpha < 1.0f ? alpha : 1.0f;
+}
+
+std::unique_ptr<IGameState> GameManager::CreateScene(SceneId id) {
+	switch (id) {
+	case SceneId::Title: return std::make_unique<TitleState>(this);
+	case SceneId::InGame: return std::make_unique<InGameState>(this);
+	case SceneId::Result: return std::make_unique<ResultState>(this);
+	default: return nullptr;
+	}
+}
+
+std::unique_ptr<IGameState> GameManager::TakeScene(SceneId id) {
+	PooledScene& slot = m_scenePool[(int)id];
+	if (!slot.scene) {
+		//ǂ݂ĂȂ̂ŁAō
+		std::unique_ptr<IGameState> scene = CreateScene(id);
+		scene->Prepare();
+		return scene;
+	}
+	//܂ Prepare IĂȂΑ҂ (O͂Ŏ󂯎)
+	if (slot.preparing.valid()) slot.preparing.get();
+	return std::move(slot.scene);
+}
+
+void GameManager::PreloadSuccessors() {
+	IGameState* current = currentState();
+	if (current == nullptr) return;
+	SceneId successors[(int)SceneId::Count];
+	const int count = current->Successors(successors, (int)SceneId::Count);
+	for (int i = 0; i < count; i++) {
+		PooledScene& slot = m_scenePool[(int)successors[i]];
+		if (slot.scene) continue;
+		slot.scene = CreateScene(successors[i]);
+		StartPrepare(slot);
+	}
+}
+
+void GameManager::RetireScene(std::unique_ptr<IGameState> scene) {
+	if (!scene) return;
+	//ĂV[tHg摜̎QƂ͎ (ReleaseUnused ŉł悤)
+	scene->Terminate();
+	const SceneId id = scene->Id();
+	if (id == SceneId::None || !scene->KeepWarm() || m_scenePool[(int)id].scene) return;
+	//ɗƂ̂߂ɁA߂̏Ԃɍ蒼Ă
+	PooledScene& slot = m_scenePool[(int)id];
+	slot.scene = std::move(scene);
+	StartPrepare(slot);
+}
+
+void GameManager::StartPrepare(PooledScene& slot) {
+	IGameState* scene = slot.scene.get();
+	slot.preparing = std::async(std::launch::async, [scene] {
+		Profiler::SetThreadName("ScenePrepare");
+		scene->Prepare();
+	});
+}
+
+void GameManager::ClearScenePool() {
+	for (PooledScene& slot : m_scenePool) {
+		if (slot.preparing.valid()) slot.preparing.wait();
+		slot.preparing = std::future<void>();
+		slot.scene.reset();
+	}
+}
+
+void GameManager::RegisterResources() {
+	//V[͂Ō߂L[ Acquire 
+	m_resources.RegisterFont("font.title", "Data/YDWaosagi.otf", "YDW  R", 30, 3);
+	m_resources.RegisterFont("font.game", "Data/YDWaosagi.otf", "YDW  R", 25, 3);
+	m_resources.RegisterFont("font.result", "Data/YDWaosagi.otf", "YDW  R", 30, 5);
+	m_resources.RegisterImage("image.game", "Data/Image1.png");
+}
+
+int GameManager::ConsumeFixedSteps(float deltaTime) {
+	const float fixedDeltaTime = 1.0f / GameData::physicsRate;
+	const float maxAccumulated = fixedDeltaTime * GameData::maxSubSteps;
+
+	//ŗ܂肷͎̂Ă (̕Q[̎Ԃ͂i)
+	m_accumulator += deltaTime;
+	if (m_accumulator > maxAccumulated) {
+		m_accumulator = maxAccumulated;
+	}
+
+	int steps = 0;
+	while (m_accumulator >= fixedDeltaTime) {
+		m_accumulator -= fixedDeltaTime;
+		steps++;
+	}
+
+	m_interpolationAlpha = m_accumulator / fixedDeltaTime;
+	return steps;
+}
+
+void GameManager::RunFixedSteps(int steps) {
+	PROFILE_SCOPE("RunFixedSteps");
+	//ŒXebv͖񓯂ŋ߂ (oߎԂɈ˂Ȃ)
+	const float fixedDeltaTime = 1.0f / GameData::physicsRate;
+	for (int i = 0; i < steps; i++) {
+		if (!m_currentState.empty()) {
+			PROFILE_SCOPE("Scene::FixedUpdate");
+			m_currentState.top()->FixedUpdate(&m_inputState, fixedDeltaTime, m_frameContext);
+		}
+	}
+}
+
+void GameManager::RecordOrVerifyFrame(bool replaying, float deltaTime, int steps) {
+	if (!m_recorder.IsOpen() && !replaying) return;
+	const uint32_t hash = m_currentState.empty() ? 0 : m_currentState.top()->StateHash();
+	if (replaying) {
+		//L^ƂƈႤʂɂȂŏ̃t[oĂ
+		if (m_replayMismatchFrame < 0 && m_logFrame.stateHash != hash) {
+			m_replayMismatchFrame = m_player.FrameIndex() - 1;
+		}
+		return;
+	}
+	m_logFrame.deltaTime = deltaTime;
+	m_logFrame.steps = steps;
+	m_logFrame.stateHash = hash;
+	m_recorder.WriteFrame(m_logFrame);
+}
+
+bool GameManager::StartRecording(const char* path) {
+	//SSE2 / AVX2  rsqrt  CPU ɂČʂႤ̂ŁAL^͂ǂ PC łɂȂXJ[ŉ
+	//̎Ԃ̗\Z InGameState L^͎gȂ (DeterministicPhysics)
+	InputLogHeader header;
+	header.physicsRate = GameData::physicsRate;
+	header.simdLevel = (int)SimdLevel::Scalar;
+	header.solverBudgetUs = 0;
+	if (!m_recorder.Open(path, header)) return false;
+	SetSimdLevel(SimdLevel::Scalar);
+	return true;
+}
+
+bool GameManager::StartReplay(const char* path) {
+	if (!m_player.Open(path)) return false;
+	//ŒXebv̕ႤƓʂɂȂȂ
+	if (m_player.Header().physicsRate != GameData::physicsRate) {
+		m_player.Close();
+		return false;
+	}
+	//Ԃ̗\ZŔł؂ĂL^́AvŌʂς̂ōČłȂ
+	if (m_player.Header().solverBudgetUs != 0) {
+		printfDx("̋L^͔̎Ԃ̗\Z (%d us) gĂ̂ōČłȂ\n", m_player.Header().solverBudgetUs);
+		m_player.Close();
+		return false;
+	}
+	//L^ƂƓ߃Zbgŉ
+	// CPU ΉĂȂ SetSimdLevel Ă܂AŏvȂ̂ōĐȂ
+	const SimdLevel recorded = (SimdLevel)m_player.Header().simdLevel;
+	const SimdLevel previous = GetSimdLevel();
+	SetSimdLevel(recorded);
+	if (GetSimdLevel() != recorded) {
+		printfDx("̋L^ %s ŉĂ邪A CPU ł %s ܂łgȂ\n",
+			SimdLevelName(recorded), SimdLevelName(GetSimdLevel()));
+		SetSimdLevel(previous);
+		m_player.Close();
+		return false;
+	}
+	m_simdLevelBeforeReplay = previous;
+	m_replayMismatchFrame = -1;
+	return true;
+}
+
+void GameManager::StopReplay() {
+	m_player.Close();
+	//vĈ߂ɕς߃Zbgɖ߂
+	SetSimdLevel(m_simdLevelBeforeReplay);
 }
 
 void GameManager::Draw() {
 	ClearDrawScreen();
 
-	if (!m_currentState.empty())m_currentState.top()->Draw();
-	else {
-		DrawString(100, 100, "current Scene not exist", GetColor(0, 0, 0));
+	{
+		PROFILE_SCOPE("Scene::Draw");
+		if (!m_currentState.empty())m_currentState.top()->Draw();
+		else {
+			DrawString(100, 100, "current Scene not exist", GetColor(0, 0, 0));
+		}
 	}
 
 	int x, y;
 	GetMousePoint(&x, &y);
 	DrawFormatString(10, 10, GetColor(0, 0, 0), "x:%d y:%d", x, y);
+	DrawReplayStatus();
+
+	if (m_showAllocationOverlay) DrawAllocationOverlay();
+	if (m_showProfilerOverlay) DrawProfilerOverlay();
+	if (m_showFramePacingOverlay) DrawFramePacingOverlay();
+
+	{
+		PROFILE_SCOPE("ScreenFlip");
+		ScreenFlip();
+	}
+	{
+		PROFILE_SCOPE("FramePacer::Wait");
+		m_framePacer.WaitForNextFrame();
+	}
+	CheckFrameAllocations();
+	Profiler::EndFrame();
+}
+
+void GameManager::CheckFrameAllocations() {
+	if (!AllocationTracker::Enabled()) return;
+	const AllocationTracker::FrameStats frame = AllocationTracker::CurrentFrame();
+	AllocationTracker::EndFrame();
+	//V[ς̓obt@̂ŁAĂ璲ׂ
+	if (m_framesSinceTransition < STEADY_STATE_FRAMES) {
+		m_framesSinceTransition++;
+		return;
+	}
+	//ǂŊmۂ F1 ̃I[o[C F2  CSV ŊmF
+	assert(frame.count == 0 && "Ԃ̃t[Ńq[vmۂ");
+	(void)frame;
+}
+
+void GameManager::DrawAllocationOverlay() {
+	const unsigned int color = GetColor(255, 0, 0);
+	if (!AllocationTracker::Enabled()) {
+		DrawString(10, 30, "allocation tracking off (ALLOCATION_TRACKING=0)", color);
+		return;
+	}
 
-	ScreenFlip();
+	//`悵Ă邱̃t[̕ƁA߂̗ł̍ő
+	static AllocationTracker::FrameStats history[AllocationTracker::HISTORY_SIZE];
+	const int historyCount = AllocationTracker::FrameHistory(history, AllocationTracker::HISTORY_SIZE);
+	unsigned int maxCount = 0;
+	unsigned long long maxBytes = 0;
+	for (int i = 0; i < historyCount; i++) {
+		if (history[i].count > maxCount) maxCount = history[i].count;
+		if (history[i].bytes > maxBytes) maxBytes = history[i].bytes;
+	}
+	const AllocationTracker::FrameStats frame = AllocationTracker::CurrentFrame();
+	DrawFormatString(10, 30, color, "alloc/frame:%u (%llu bytes)  max:%u (%llu bytes) in %d frames",
+		frame.count, frame.bytes, maxCount, maxBytes, historyCount);
+
+	//͈̔͂ŊmۂĂяo񐔂̑
+	const unsigned int frameNumber = AllocationTracker::FrameNumber();
+	const unsigned int sinceFrame = frameNumber > (unsigned int)historyCount ? frameNumber - historyCount : 0;
+	static AllocationTracker::CallSite sites[OVERLAY_SITE_COUNT];
+	const int siteCount = AllocationTracker::TopCallSites(sites, OVERLAY_SITE_COUNT, sinceFrame);
+	char description[256];
+	for (int i = 0; i < siteCount; i++) {
+		AllocationTracker::DescribeCallSite(sites[i], description, sizeof(description));
+		DrawFormatString(10, 50 + i * 20, color, "%6llu %s", sites[i].count, description);
+	}
+}
+
+void GameManager::DrawReplayStatus() {
+	const unsigned int color = GetColor(255, 0, 0);
+	const int x = GameData::windowWidth / 2;
+	if (m_recorder.IsOpen()) {
+		DrawFormatString(x, 10, color, "REC %d", m_recorder.FrameCount());
+	}
+	if (m_player.IsOpen()) {
+		DrawFormatString(x, 10, color, "REPLAY %d", m_player.FrameIndex());
+	}
+	if (m_replayMismatchFrame >= 0) {
+		DrawFormatString(x, 30, color, "replay diverged at frame %d", m_replayMismatchFrame);
+	}
+}
+
+void GameManager::DrawProfilerOverlay() {
+	PROFILE_SCOPE("ProfilerOverlay");
+	const unsigned int textColor = GetColor(0, 0, 128);
+
+	//Õt[Ԏɕׂ (t[̎ԁAcq̐[)
+	static Profiler::Event events[OVERLAY_FLAME_EVENTS];
+	int64_t frameBegin = 0;
+	const int eventCount = Profiler::FrameEvents(events, OVERLAY_FLAME_EVENTS, frameBegin);
+	float p50 = 0, p99 = 0;
+	Profiler::FramePercentiles(p50, p99);
+	const float frameMs = Profiler::FrameMs();
+
+	const int rowHeight = 16;
+	const int rows = 8;
+	const int left = 10;
+	const int width = GameData::windowWidth - 20;
+	const int top = GameData::windowHeight - 10 - rows * rowHeight;
+	//60fps 1t[ZƂ 16.7ms Sɂ (Zt[Z悤)
+	const float spanMs = (frameMs > 1000.0f / 60.0f) ? frameMs : 1000.0f / 60.0f;
+	const float pixelsPerNs = width / (spanMs * 1000000.0f);
+	DrawBox(left, top, left + width, top + rows * rowHeight, GetColor(255, 255, 255), TRUE);
+	DrawFormatString(left, top - 20, textColor, "frame:%.2fms p50:%.2fms p99:%.2fms", frameMs, p50, p99);
+	for (int i = 0; i < eventCount; i++) {
+		const Profiler::Event& e = events[i];
+		if (e.depth >= rows) continue;
+		const int x0 = left + (int)((e.begin - frameBegin) * pixelsPerNs);
+		const int x1 = x0 + 1 + (int)(e.duration * pixelsPerNs);
+		const int y0 = top + e.depth * rowHeight;
+		//O̐擪̕ŐFς (Ԃ͖t[FɂȂ)
+		const unsigned char hue = (unsigned char)(e.name[0] * 37 + e.name[1] * 17);
+		DrawBox(x0, y0, x1, y0 + rowHeight - 1, GetColor(128 + hue / 2, 200 - hue / 3, 96 + hue / 4), TRUE);
+		if (x1 - x0 > 80) DrawString(x0 + 2, y0, e.name, textColor);
+	}
+
+	//ԂƂ̎ (Õt[ / ߂ p50 / p99)
+	static Profiler::ZoneStats zones[OVERLAY_ZONE_COUNT];
+	const int zoneCount = Profiler::FrameZones(zones, OVERLAY_ZONE_COUNT);
+	const int tableLeft = GameData::windowWidth - 520;
+	DrawFormatString(tableLeft, 10, textColor, "%-28s %7s %7s %7s %5s", "zone", "ms", "p50", "p99", "calls");
+	for (int i = 0; i < zoneCount; i++) {
+		const Profiler::ZoneStats& z = zones[i];
+		DrawFormatString(tableLeft + z.depth * 12, 30 + i * 18, textColor, "%-*s %7.2f %7.2f %7.2f %5d",
+			28 - z.depth * 2, z.name, z.ms, z.p50, z.p99, z.calls);
+	}
+
+	//JE^ (̔񐔂cBÕt[̕ / ő / ߂ p50 / p99)
+	static Profiler::CounterStats counters[OVERLAY_COUNTER_COUNT];
+	const int counterCount = Profiler::FrameCounters(counters, OVERLAY_COUNTER_COUNT);
+	const int counterTop = 50 + zoneCount * 18;
+	DrawFormatString(tableLeft, counterTop, textColor, "%-20s %9s %9s %9s %9s", "counter", "mean", "max", "p50", "p99");
+	for (int i = 0; i < counterCount; i++) {
+		const Profiler::CounterStats& c = counters[i];
+		DrawFormatString(tableLeft, counterTop + 20 + i * 18, textColor, "%-20s %9.3f %9.3f %9.3f %9.3f",
+			c.name, c.mean, c.max, c.p50, c.p99);
+	}
+}
+
+void GameManager::DrawFramePacingOverlay() {
+	const unsigned int textColor = GetColor(0, 96, 0);
+	const FramePacer::Stats stats = m_framePacer.GetStats();
+	const int left = 10;
+	const int top = 220;
+	DrawFormatString(left, top, textColor, "target:%dfps avg:%.2fms p50:%.2fms p99:%.2fms max:%.2fms",
+		m_framePacer.TargetRate(), stats.averageMs, stats.p50Ms, stats.p99Ms, stats.maxMs);
+	DrawFormatString(left, top + 20, textColor, "jitter:%.3fms missed:%d spin:%.2fms (%d frames)",
+		stats.jitterMs, stats.missed, stats.spinMs, stats.frames);
+
+	//qXgO (1sNZ1ԁAԑԂςɂ)
+	static int histogram[FramePacer::BUCKET_COUNT];
+	m_framePacer.Histogram(histogram);
+	int maxCount = 1;
+	for (int b = 0; b < FramePacer::BUCKET_COUNT; b++) {
+		if (histogram[b] > maxCount) maxCount = histogram[b];
+	}
+	const int height = 100;
+	const int bottom = top + 45 + height;
+	DrawBox(left, bottom - height, left + FramePacer::BUCKET_COUNT, bottom, GetColor(255, 255, 255), TRUE);
+	for (int b = 0; b < FramePacer::BUCKET_COUNT; b++) {
+		if (histogram[b] == 0) continue;
+		const int barHeight = 1 + histogram[b] * (height - 1) / maxCount;
+		DrawLine(left + b, bottom, left + b, bottom - barHeight, textColor);
+	}
+	//ڕW̊Ԋüʒuɏc
+	if (m_framePacer.TargetRate() > 0) {
+		const int targetX = left + 1000000 / m_framePacer.TargetRate() / FramePacer::BUCKET_US;
+		DrawLine(targetX, bottom - height, targetX, bottom, GetColor(255, 0, 0));
+	}
 }
 
 void GameManager::Finalize() {
+	//V[jOɁA[hi߂ĂXbh~߂
+	m_simulation.Stop();
+	m_recorder.Close();
+	m_player.Close();
 	while (!m_currentState.empty()) {
 		m_currentState.pop();
 	}
+	ClearScenePool();
+	m_resources.Finalize();
 
 	DxLib_End();
 }
 
-void GameManager::UpdateInputState()
+void GameManager::UpdateInputState(bool replaying)
 {
-	// ݂̃L[ԂOt[̃L[ԂƂĕۑ
-	memcpy(m_inputState.prevKey, m_inputState.key, sizeof(m_inputState.key));
-
-	char tmpKey[256];
-	// DxCu猻݂̃L[Ԃ擾
-	GetHitKeyStateAll(tmpKey);
-	for (int i = 0; i < 256; i++) {
-		if (tmpKey[i] != 0) {
-			m_inputState.key[i]++;
-		}
-		else {
-			m_inputState.key[i] = 0;
+	// DxCu猻݂̃L[Ԃ擾ărbgɋl߂ (vC̓Oǂ񂾂̂g)
+	if (!replaying) {
+		char tmpKey[256];
+		GetHitKeyStateAll(tmpKey);
+		KeyBits now;
+		for (int i = 0; i < 256; i++) {
+			if (tmpKey[i] != 0) now.Set(i);
 		}
+		m_logFrame.pressed = now;
 	}
+	// E̔ƉԁACxg̐ InputState ܂Ƃ߂čs
+	m_inputState.Advance(m_logFrame.pressed, m_inputClock);
 
 	// TODO: }EXQ[pbh̓͂ɒǉ
 }
\ No newline at end of file
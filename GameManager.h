@@ -1,12 +1,19 @@
 #pragma once
+#include <future>
 #include <memory>
 #include <stack>
 #include "IGameState.h"
 #include "InputState.h"
+#include "InputLog.h"
+#include "FramePacer.h"
+#include "SimulationThread.h"
+#include "ResourceManager.h"
+#include "PhysicsCore/SimdSupport.h"
 
 class TitleState;
 class InGameState;
 class ResultState;
+class WorldSnapshot;
 
 class GameManager {
 public:
@@ -29,13 +36,85 @@ public:
 		m_isGameFinished = true;
 	}
 
+	// ͂ƃXebv path ɋL^ / path ̋L^ŏ̃t[Đ
+	// ǂ Initialize ̌Aŏ Update ̑OɌĂ (Ԃn߂ȂƍČȂ)
+	// L^͂ǂ PC łʂɂȂ悤AXJ[̃J[lŉA̎Ԃ̗\ZgȂ
+	bool StartRecording(const char* path);
+	bool StartReplay(const char* path);
+	// v CPU Ōʂςݒ (̎Ԃ̗\Z) gȂ
+	bool DeterministicPhysics() const {
+		return GameData::deterministicPhysics || m_recorder.IsOpen() || m_player.IsOpen();
+	}
+
+	// V[LtHgƉ摜
+	ResourceManager& Resources() { return m_resources; }
+
+	// snapshot ̑ȌԂԂĕ`Ƃ̐i݋ (0`1)
+	// ʃXbhŐi߂ĂƂ̓XibvVbgĂ̎ԁAȊO͗܂Ă鎞Ԃ狁߂
+	float GetInterpolationAlpha(const WorldSnapshot& snapshot) const;
+
 private:
 	//std::unique_ptr<IGameState> m_currentState;
 	bool m_isGameFinished; // ǉ: Q[ItO
 	InputState m_inputState;
-	float m_prevTime = 0;
+	LONGLONG m_prevTime = 0;		//Ot[̎ (}CNb)
+	double m_inputClock = 0;		//deltaTime ς񂾃Q[̎v (̓Cxg̎, b)
+	float m_accumulator = 0;		//܂XebvɏĂȂ
+	float m_interpolationAlpha = 1;
+	int m_framesSinceTransition = 0;		//V[ςẴt[
+	FrameArena m_frameArena;				//1t[gƗp (Update ̐擪ŋɂ)
+	FrameContext m_frameContext;			//V[ƕɓnÃt[̏
+	InputLogFrame m_logFrame = {};			//̃t[̃L[ƃXebv (L^EvCp)
+	InputRecorder m_recorder;
+	InputPlayer m_player;
+	int m_replayMismatchFrame = -1;			//vCL^ƐHŏ̃t[
+	SimdLevel m_simdLevelBeforeReplay = SimdLevel::Scalar;	//vCn߂O̖߃Zbg (I߂)
+	ResourceManager m_resources;			//V[ɔj (V[QƂĂ邽)
+	//ǂ݁Eg񂵗p̃V[ (SceneId Ƃ1Bm_resources ɔj)
+	struct PooledScene {
+		std::unique_ptr<IGameState> scene;
+		std::future<void> preparing;		// Prepare ĂԂ valid
+	};
+	PooledScene m_scenePool[(int)SceneId::Count];
+	SimulationThread m_simulation;			//̌ŒXebvi߂Xbh (GameData::threadedSimulation)
+	bool m_showAllocationOverlay = false;	//F1 Ő؂ւ
+	bool m_showProfilerOverlay = false;		//F3 Ő؂ւ
+	bool m_showFramePacingOverlay = false;	//F5 Ő؂ւ
+	FramePacer m_framePacer;				//ScreenFlip ̌Ŏ̃t[܂ő҂
+
+	std::unique_ptr<IGameState> CreateScene(SceneId id);
+	//id ̃V[ Prepare ς񂾏ԂŎo (ǂ݂ԂɍĂȂΑ҂AȂ΍)
+	std::unique_ptr<IGameState> TakeScene(SceneId id);
+	//̃V[̈ڂāÃXbh Prepare Ă
+	void PreloadSuccessors();
+	//ꂽV[ Terminate AKeepWarm Ȃ痠 Prepare ăv[ɖ߂AȊÔ͎Ă
+	void RetireScene(std::unique_ptr<IGameState> scene);
+	//v[ɂV[ Prepare 𗠂̃XbhŎn߂
+	void StartPrepare(PooledScene& slot);
+	// Prepare ҂ăv[ɂ
+	void ClearScenePool();
+	//V[gtHgƉ摜L[œo^ (ǂݍނ̂ Acquire ꂽƂ)
+	void RegisterResources();
+	//oߎԂ𗭂߂āAt[Ői߂镨̃XebvԂ
+	int ConsumeFixedSteps(float deltaTime);
+	void RunFixedSteps(int steps);
+	//L^Ȃ炱̃t[OɏAvCȂL^Ƃ̌ʂƔׂ
+	void RecordOrVerifyFrame(bool replaying, float deltaTime, int steps);
+	//L^EvC̕\
+	void DrawReplayStatus();
+	//vCāA߃Zbgn߂Ô̂ɖ߂
+	void StopReplay();
+	//t[̊mۂ̏Wv߂āAԂŃq[vmۂȂ𒲂ׂ (ALLOCATION_TRACKING ̂Ƃ̂)
+	void CheckFrameAllocations();
+	//t[Ƃ̊mۉ񐔂ƁAmۂĂĂяoʂɏo
+	void DrawAllocationOverlay();
+	//Õt[̋ԂԎɕׂ}ƁAԂƂ̎ (p50 / p99) ʂɏo
+	void DrawProfilerOverlay();
+	//߂̃t[Ԃ̃qXgOƁAρEp50Ep99Eʂɏo
+	void DrawFramePacingOverlay();
 
-	void UpdateInputState();
+	//replaying Ȃ m_logFrame ̃L[AȊO DxLib ǂ񂾃L[g
+	void UpdateInputState(bool replaying);
 
 	std::stack<std::unique_ptr<IGameState>> m_currentState;
 
@@ -1,14 +1,16 @@
 #pragma once
 #include "DxLib.h"
 #include "GameData.h"
+#include "PhysicsCore/FrameArena.h"
 #include <string>
 
 #include <cstdarg>
+#include <cstdint>
 #include <memory>
 
 class GameManager;
 class IGameState;
-struct InputState;
+class InputState;
 
 enum GameCondition
 {
@@ -25,10 +27,29 @@ enum class TransitionType {
 	Popup,		//ꎞIɕʂ̃V[ɂ
 };
 
+// GameManager Aǂ݂Ďg񂷃V[̎
+enum class SceneId {
+	None,
+	Title,
+	InGame,
+	Result,
+	Count,
+};
+
 // Jڏێ\
+// Update ͒lŕԂBJڂȂt[ {} ԂȂ̂Ńq[vgȂ
+// Change  nextScene ōsw肷ƁAGameManager ǂ݂ĂV[ɐ؂ւ
 struct SceneTransition {
-	TransitionType type;
+	TransitionType type = TransitionType::None;
 	std::unique_ptr<IGameState> nextState;
+	SceneId nextScene = SceneId::None;
+
+	static SceneTransition ChangeTo(SceneId scene) {
+		SceneTransition transition;
+		transition.type = TransitionType::Change;
+		transition.nextScene = scene;
+		return transition;
+	}
 };
 
 class IGameState {
@@ -37,11 +58,30 @@ public:
 
 	virtual ~IGameState() = default;
 
+	//d ([hȂ)B؂ւOɗ̃XbhŌĂ΂邱Ƃ̂ŁA
+	//DxLib ̕`Eǂݍ݂ ResourceManager ͎gȂƁBg񂷂Ƃ͗ꂽɂxĂ΂
+	virtual void Prepare() {}
+	//؂ւƂɃCXbhŌĂ΂ (Prepare ̌Bg񂷂Ƃ͓邽тɌĂ΂)
 	virtual void Init() = 0;
-	virtual SceneTransition* Update(const InputState* input, float deltaTime) = 0;
+	//frame.arena ͂̃t[̊ԂgƗp (Update ̑OɋɂȂ)
+	virtual SceneTransition Update(const InputState* input, float deltaTime, const FrameContext& frame) = 0;
+	//̌ŒXebv (1t[0ȏĂ΂BfixedDeltaTime ͏ɓl)
+	//V~[ṼXbhĂ΂邱Ƃ (UpdateEInit Ɠɂ͌Ă΂Ȃ)B
+	//Draw Ƃ͓ɌĂ΂̂ŁADraw ͕̏Ԃ[h̃XibvVbgǂ
+	virtual void FixedUpdate(const InputState* input, float fixedDeltaTime, const FrameContext& frame) {}
 	virtual void Draw() = 0;
+	//V[̏Ԃ̃nbV (vCŋL^ƂƓʂɂȂ𒲂ׂB0 Ȃ璲ׂȂ)
+	virtual uint32_t StateHash() const { return 0; }
+	//ƂɃCXbhŌĂ΂ (g񂷃V[Ă΂̂ŁAInit ŎQƂ͂Ŏ)
 	virtual void Terminate() = 0;
 
+	//GameManager V[̎ (SceneId::None Ȃǂ݂g񂵂Ȃ)
+	virtual SceneId Id() const { return SceneId::None; }
+	//̃V[ Change ňڂ (GameManager ɍ Prepare Ă)B߂l͐
+	virtual int Successors(SceneId* out, int maxCount) const { return 0; }
+	//ꂽ̂ĂɎĂAPrepare Ďɔ邩 (xsV[)
+	virtual bool KeepWarm() const { return false; }
+
 protected:
 	GameManager* m_gameManager;
 };
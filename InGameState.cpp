@@ -3,53 +3,111 @@
 #include "ResultState.h"
 #include "DxLib.h"
 
+namespace {
+	const char* const RESOURCE_KEYS[] = { "font.game", "image.game" };
+}
+
+const ResourceList InGameState::RESOURCES = { RESOURCE_KEYS, sizeof(RESOURCE_KEYS) / sizeof(RESOURCE_KEYS[0]) };
+
+void InGameState::Prepare() {
+	//OV񂾂Ƃ̂̂́ARA[hɎ̂Ă
+	m_PBDRingSim.reset();
+	//[h͍ŏ1񂾂Ag񂷂Ƃ͋ɂ ([J[̃Xbh蒼Ȃ)
+	if (m_world) {
+		m_world->Clear();
+		m_world->Statics().Clear();
+	}
+	else {
+		m_world = std::make_unique<PhysicsWorld>();
+	}
+	BuildLevel();
+	//m_springManager = std::make_shared<SpringManager>(*m_world);
+	//m_spring_GravityManager = std::make_shared<SpringAndGravityManager>(*m_world);
+	//m_stringPointManager = std::make_shared<StringPointManager>(*m_world, 320.0f, 100.0f, 10, 15.0f, 200.0f, 300.0f);
+	/*m_PBDSimulation = std::make_shared<PBDSimulation>(*m_world);
+	m_PBDSimulation2 = std::make_shared<PBDSimulation>(*m_world);
+	m_PBDSimulation2->Core().testCount = 1;
+	m_PBDSimulation2->nodeColor = GetColorU8(0, 255, 0, 255);*/
+	m_PBDRingSim = std::make_shared<PBDRingSim>(*m_world);
+	//ŏ̃Xebv̑O`悤ɁAu܂܂̏ԂnĂ
+	m_world->PublishSnapshot();
+}
+
 void InGameState::Init() {
 	SetBackgroundColor(200, 200, 200);
-	//gp̃p\RɈꎞIFontǂݍ܂
-	AddFontResourceEx("Data/YDWaosagi.otf", FR_PRIVATE, 0);
-	m_gameFontHandle = CreateFontToHandle("YDW  R", 25, 3);
-	//m_springManager = std::make_shared<SpringManager>();
-	//m_spring_GravityManager = std::make_shared<SpringAndGravityManager>();
-	//m_stringPointManager = std::make_shared<StringPointManager>(320.0f, 100.0f, 10, 15.0f, 200.0f, 5.0f);
-	/*m_PBDSimulation = std::make_shared<PBDSimulation>();
-	m_PBDSimulation2 = std::make_shared<PBDSimulation>();
-	m_PBDSimulation2->testCount = 1;
-	m_PBDSimulation2->nodeColor = GetColor(0, 255, 0);*/
-	m_PBDRingSim = std::make_shared<PBDRingSim>();
-}
-
-SceneTransition* InGameState::Update(const InputState* input, float deltaTime) {
+	//̎Ԃ̗\Z͎vŌʂς̂ŁAL^EvC͎gȂ
+	//(Prepare ͋L^n߂Oɗōςł邱Ƃ̂ŁA邽тɂŌ߂)
+	PhysicsWorld::SolverSettings solver = m_world->GetSolverSettings();
+	solver.budgetMs = m_gameManager->DeterministicPhysics() ? 0.0f : GameData::solverBudgetUs / 1000.0f;
+	m_world->SetSolverSettings(solver);
+	ResourceManager& resources = m_gameManager->Resources();
+	m_gameFont = resources.Acquire("font.game");
+	m_gameGraph = resources.Acquire("image.game");
+	m_preload = resources.AcquireAll(ResultState::RESOURCES);
+}
+
+SceneTransition InGameState::Update(const InputState* input, float deltaTime, const FrameContext& frame) {
 	//SpaceƂ̓Q[V[ֈڍs
 	if (input->IsKeyDown(KEY_INPUT_SPACE)) {
-		SceneTransition* trans = new SceneTransition{ TransitionType::Change,
-			std::make_unique<ResultState>(m_gameManager) };
-		return trans;
+		return SceneTransition::ChangeTo(SceneId::Result);
 	}
 
-	//m_springManager->Update(input, deltaTime);
-	//m_spring_GravityManager->Update(input, deltaTime);
-	//m_stringPointManager->Update();
+	return {};
+}
+
+void InGameState::FixedUpdate(const InputState* input, float fixedDeltaTime, const FrameContext& frame) {
+	//m_springManager->Update(input, fixedDeltaTime);
+	//m_spring_GravityManager->Update(input, fixedDeltaTime);
+	//m_stringPointManager->Update(input);
 	/*m_PBDSimulation->Update(input);
 	m_PBDSimulation2->Update(input);*/
 	m_PBDRingSim->Update(input);
 
-	SceneTransition* trans = new SceneTransition{ TransitionType::None, nullptr };
-	return trans;
+	//͂nIĂASIuWFNg܂Ƃ߂Đi߂
+	m_world->Step(fixedDeltaTime, frame);
+	//`͐i߂ʂ̃Rs[ǂ (V~[VʃXbhł`ƏdȂȂ)
+	m_world->PublishSnapshot();
+}
+
+void InGameState::BuildLevel() {
+	StaticColliderSet& statics = m_world->Statics();
+	// (艺ɂ͐i߂Ȃ)B y > 700 ̔ƓAx ǂłAǂꂾ[߂荞ł߂
+	//`͈ԋ߂ʂôŁAƉ͂Ȃقǉɒu΁A̖ʂo
+	const float floorY = 700.0f;
+	const float farAway = 1.0e9f;
+	statics.AddBox({ -farAway, floorY }, { farAway, farAway });
+	//BVH ͍ŏ Step ̑Oɍ
 }
 
 void InGameState::Draw() {
-	GameData::DrawStringWithAnchor(100, GameData::windowHeight / 2, 0, 0.5f,
-		GetColor(255, 255, 255), m_gameFontHandle, "Press Space \nto See Result");
+	//tHg̓ǂݍ݂I܂ł͕oȂ
+	if (m_gameFont.IsReady()) {
+		GameData::DrawStaticStringWithAnchor(100, GameData::windowHeight / 2, 0, 0.5f,
+			GetColor(255, 255, 255), m_gameFont.Handle(), "Press Space \nto See Result");
+	}
 
-	//m_springManager->Draw();
-	//m_spring_GravityManager->Draw();
-	//m_stringPointManager->Draw();
-	//m_PBDSimulation2->Draw();
-	//m_PBDSimulation->Draw();
-	m_PBDRingSim->Draw();
+	//ŐṼXibvVbg̑O̕Xebv̊ԂԂĕ`
+	const WorldSnapshot& snapshot = m_world->LatestSnapshot();
+	const float alpha = m_gameManager->GetInterpolationAlpha(snapshot);
+	//m_springManager->Draw(snapshot, alpha);
+	//m_spring_GravityManager->Draw(snapshot, alpha);
+	//m_stringPointManager->Draw(snapshot, m_batch, alpha);
+	//m_PBDSimulation2->Draw(snapshot, m_batch, alpha);
+	//m_PBDSimulation->Draw(snapshot, m_batch, alpha);
+	m_PBDRingSim->Draw(snapshot, m_batch, alpha);
+	//߂~Ɛ DrawPolygon2D 1ŕ`
+	m_batch.Flush();
 }
 
 void InGameState::Terminate() {
-	//ǂݍ܂tHgJ
-	RemoveFontResourceEx("Data/YDWaosagi.otf", FR_PRIVATE, 0);
-}
\ No newline at end of file
+	//ĂԂ͎QƂȂ ( Init ł܂ Acquire )
+	m_gameFont.Reset();
+	m_gameGraph.Reset();
+	m_preload.clear();
+}
+
+int InGameState::Successors(SceneId* out, int maxCount) const {
+	if (maxCount < 1) return 0;
+	out[0] = SceneId::Result;
+	return 1;
+}
@@ -5,6 +5,10 @@
 #include "StringPointManager.h"
 #include "PBDSimulation.h"
 #include "PBDRingSim.h"
+#include "PhysicsCore/PhysicsWorld.h"
+#include "PrimitiveBatch.h"
+#include "ResourceManager.h"
+#include <vector>
 
 class GameManager;
 
@@ -13,18 +17,37 @@ public:
 	InGameState(GameManager* gameManager) :IGameState(gameManager) {}
 	~InGameState()override = default;
 
+	//[hƕ̂蒼 (̃XbhŌĂ΂)
+	void Prepare()override;
 	void Init()override;
-	SceneTransition* Update(const InputState* input, float deltaTime)override;
+	SceneTransition Update(const InputState* input, float deltaTime, const FrameContext& frame)override;
+	void FixedUpdate(const InputState* input, float fixedDeltaTime, const FrameContext& frame)override;
 	void Draw()override;
+	uint32_t StateHash() const override { return m_world->StateHash(); }
 	void Terminate()override;
 
+	SceneId Id() const override { return SceneId::InGame; }
+	int Successors(SceneId* out, int maxCount) const override;
+	bool KeepWarm() const override { return true; }
+
+	//̃V[ŎgtHgƉ摜 (JڂÕV[ɓǂݎn߂Ă)
+	static const ResourceList RESOURCES;
+
 private:
-	int m_gameGraphHandle;
-	int m_gameFontHandle;
+	//x̏ǂ[hɓo^
+	void BuildLevel();
+
+	ResourceRef m_gameGraph;
+	ResourceRef m_gameFont;
+	std::vector<ResourceRef> m_preload;		// ResultState Ŏg
+	//V[̕IuWFNg܂Ƃ߂ĎAɐi߂ (eManagerɔjȂ悤ɐ錾)
+	std::unique_ptr<PhysicsWorld> m_world;
 	std::shared_ptr<SpringManager> m_springManager;
 	std::shared_ptr<SpringAndGravityManager> m_spring_GravityManager;
 	std::shared_ptr<StringPointManager> m_stringPointManager;
 	std::shared_ptr<PBDSimulation> m_PBDSimulation;
 	std::shared_ptr<PBDSimulation> m_PBDSimulation2;
 	std::shared_ptr<PBDRingSim> m_PBDRingSim;
+	//OR̉~Ɛ߂āADraw ̍Ōɂ܂Ƃ߂ĕ`
+	PrimitiveBatch m_batch;
 };
\ No newline at end of file
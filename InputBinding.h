@@ -0,0 +1,25 @@
+#pragma once
+#include "DxLib.h"
+#include "InputState.h"
+#include "PhysicsCore/BodyControl.h"
+
+// InputState  WASD 𕨗{fBp̓͂ɕϊ
+inline BodyControl MakeBodyControl(const InputState* input) {
+	BodyControl control;
+	control.left = input->IsKeyStay(KEY_INPUT_A);
+	control.right = input->IsKeyStay(KEY_INPUT_D);
+	control.up = input->IsKeyStay(KEY_INPUT_W);
+	control.down = input->IsKeyStay(KEY_INPUT_S);
+	return control;
+}
+
+// u (IsKeyDown ̃t[) 甽
+// CheckHitKey ŒړǂނƃvCōČłȂ̂ŁA InputState 
+inline BodyControl MakeBodyControlImmediate(const InputState* input) {
+	BodyControl control;
+	control.left = input->IsKeyHeld(KEY_INPUT_A);
+	control.right = input->IsKeyHeld(KEY_INPUT_D);
+	control.up = input->IsKeyHeld(KEY_INPUT_W);
+	control.down = input->IsKeyHeld(KEY_INPUT_S);
+	return control;
+}
@@ -0,0 +1,160 @@
+#include "InputLog.h"
+#include <cstring>
+
+namespace {
+	const char MAGIC[4] = { 'S', 'S', 'I', 'L' };
+	const unsigned char VERSION = 2;
+
+	FILE* OpenFile(const char* path, const char* mode) {
+#ifdef _MSC_VER
+		FILE* fp = nullptr;
+		if (fopen_s(&fp, path, mode) != 0) return nullptr;
+		return fp;
+#else
+		return std::fopen(path, mode);
+#endif
+	}
+
+	void WriteVarint(FILE* fp, uint32_t value) {
+		unsigned char bytes[5];
+		int n = 0;
+		do {
+			unsigned char b = value & 0x7f;
+			value >>= 7;
+			if (value) b |= 0x80;
+			bytes[n++] = b;
+		} while (value);
+		std::fwrite(bytes, 1, n, fp);
+	}
+
+	// float  uint32_t ̓rbĝ܂܃gGfBAŏ
+	void WriteU32(FILE* fp, uint32_t value) {
+		const unsigned char bytes[4] = {
+			(unsigned char)value, (unsigned char)(value >> 8), (unsigned char)(value >> 16), (unsigned char)(value >> 24),
+		};
+		std::fwrite(bytes, 1, 4, fp);
+	}
+}
+
+InputRecorder::~InputRecorder() {
+	Close();
+}
+
+bool InputRecorder::Open(const char* path, const InputLogHeader& header) {
+	Close();
+	file = OpenFile(path, "wb");
+	if (!file) return false;
+	std::fwrite(MAGIC, 1, sizeof(MAGIC), file);
+	std::fputc(VERSION, file);
+	WriteVarint(file, (uint32_t)header.physicsRate);
+	std::fputc(header.simdLevel, file);
+	WriteVarint(file, (uint32_t)header.solverBudgetUs);
+	previous = KeyBits();
+	frameCount = 0;
+	return true;
+}
+
+void InputRecorder::Close() {
+	if (!file) return;
+	std::fclose(file);
+	file = nullptr;
+}
+
+void InputRecorder::WriteFrame(const InputLogFrame& frame) {
+	if (!file) return;
+	WriteVarint(file, (uint32_t)frame.steps);
+	uint32_t deltaBits;
+	std::memcpy(&deltaBits, &frame.deltaTime, sizeof(deltaBits));
+	WriteU32(file, deltaBits);
+	WriteU32(file, frame.stateHash);
+
+	KeyBits changedBits;
+	for (int w = 0; w < 4; w++) {
+		changedBits.words[w] = frame.pressed.words[w] ^ previous.words[w];
+	}
+	previous = frame.pressed;
+	unsigned char changed[256];
+	int changedCount = 0;
+	ForEachSetBit(changedBits, [&](int key) {
+		changed[changedCount++] = (unsigned char)key;
+	});
+	WriteVarint(file, (uint32_t)changedCount);
+	std::fwrite(changed, 1, changedCount, file);
+	frameCount++;
+}
+
+bool InputPlayer::Open(const char* path) {
+	Close();
+	FILE* fp = OpenFile(path, "rb");
+	if (!fp) return false;
+	std::fseek(fp, 0, SEEK_END);
+	const long size = std::ftell(fp);
+	std::fseek(fp, 0, SEEK_SET);
+	if (size > 0) {
+		data.resize((size_t)size);
+		if (std::fread(data.data(), 1, data.size(), fp) != data.size()) data.clear();
+	}
+	std::fclose(fp);
+
+	char magic[4];
+	unsigned char version = 0;
+	unsigned char simdLevel = 0;
+	uint32_t physicsRate = 0;
+	uint32_t solverBudgetUs = 0;
+	if (!ReadBytes(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0
+		|| !ReadBytes(&version, 1) || version != VERSION
+		|| !ReadVarint(physicsRate) || !ReadBytes(&simdLevel, 1) || !ReadVarint(solverBudgetUs)) {
+		Close();
+		return false;
+	}
+	header.physicsRate = (int)physicsRate;
+	header.simdLevel = simdLevel;
+	header.solverBudgetUs = (int)solverBudgetUs;
+	return true;
+}
+
+void InputPlayer::Close() {
+	data.clear();
+	position = 0;
+	header = {};
+	pressed = KeyBits();
+	frameIndex = 0;
+}
+
+bool InputPlayer::ReadFrame(InputLogFrame& frame) {
+	uint32_t steps, changedCount;
+	unsigned char deltaBytes[4], hashBytes[4];
+	if (!ReadVarint(steps) || !ReadBytes(deltaBytes, 4) || !ReadBytes(hashBytes, 4) || !ReadVarint(changedCount)) {
+		return false;
+	}
+	if (changedCount > 256 || position + changedCount > data.size()) return false;
+	for (uint32_t k = 0; k < changedCount; k++) {
+		pressed.Toggle(data[position++]);
+	}
+
+	const uint32_t deltaBits = deltaBytes[0] | (deltaBytes[1] << 8) | (deltaBytes[2] << 16) | ((uint32_t)deltaBytes[3] << 24);
+	std::memcpy(&frame.deltaTime, &deltaBits, sizeof(deltaBits));
+	frame.stateHash = hashBytes[0] | (hashBytes[1] << 8) | (hashBytes[2] << 16) | ((uint32_t)hashBytes[3] << 24);
+	frame.steps = (int)steps;
+	frame.pressed = pressed;
+	frameIndex++;
+	return true;
+}
+
+bool InputPlayer::ReadVarint(uint32_t& value) {
+	value = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (position >= data.size()) return false;
+		const unsigned char b = data[position++];
+		value |= (uint32_t)(b & 0x7f) << shift;
+		if (!(b & 0x80)) return true;
+	}
+	return false;
+}
+
+bool InputPlayer::ReadBytes(void* out, size_t size) {
+	if (position + size > data.size()) return false;
+	std::memcpy(out, data.data() + position, size);
+	position += size;
+	return true;
+}
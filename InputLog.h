@@ -0,0 +1,71 @@
+#pragma once
+#include "InputState.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// 1t[̋L^
+// ̓t[Ƃ̃XebvƉĂL[Ō܂̂ŁAc
+struct InputLogFrame {
+	KeyBits pressed;			// GetHitKeyStateAll ԂL[̏
+	float deltaTime;			// V[ Update ɓnl
+	int steps;					// ̃t[Ői߂̌ŒXebv
+	uint32_t stateHash;			// ̃t[̏IƂ̃V[̃nbV (0 ȂׂȂ)
+};
+
+// O̐擪ɏAʂɉeݒ
+struct InputLogHeader {
+	int physicsRate;
+	int simdLevel;				// L^Ƃ SimdLevel (vCł̂g)
+	int solverBudgetUs;			// L^Ƃ̔̎Ԃ̗\Z (0 łȂΎvŌʂς̂ōČȂ)
+};
+
+// ͂ƃXebvoCĩOɏo
+// L[͑Õt[ς̂̔ԍ (قƂǂ̃t[ 0 )B
+// 1t[͐oCgȂ̂ŁAt@CɒڏĂ (t[Ƀq[vgȂ)
+//
+// ` (l̓gGfBAAvarint 7rbgʂ):
+//   wb_: "SSIL" /  (1oCg) / physicsRate (varint) / simdLevel (1oCg) / solverBudgetUs (varint)
+//   t[: Xebv (varint) / deltaTime (float 4oCg) / nbV (4oCg) /
+//             ςL[̐ (varint) / ςL[̔ԍ (1oCg)
+class InputRecorder {
+public:
+	~InputRecorder();
+
+	bool Open(const char* path, const InputLogHeader& header);
+	void Close();
+	bool IsOpen() const { return file != nullptr; }
+
+	void WriteFrame(const InputLogFrame& frame);
+	int FrameCount() const { return frameCount; }
+
+private:
+	FILE* file = nullptr;
+	KeyBits previous;
+	int frameCount = 0;
+};
+
+// InputRecorder Oǂ݁A1t[Ԃ
+class InputPlayer {
+public:
+	// t@C܂Ƃ߂ēǂݍ (t[̓rœǂނƂ͂Ȃ)
+	bool Open(const char* path);
+	void Close();
+	bool IsOpen() const { return !data.empty(); }
+
+	const InputLogHeader& Header() const { return header; }
+
+	// ̃t[ frame ɏBȌI肩Ă false
+	bool ReadFrame(InputLogFrame& frame);
+	int FrameIndex() const { return frameIndex; }
+
+private:
+	std::vector<unsigned char> data;
+	size_t position = 0;
+	InputLogHeader header = {};
+	KeyBits pressed;
+	int frameIndex = 0;
+
+	bool ReadVarint(uint32_t& value);
+	bool ReadBytes(void* out, size_t size);
+};
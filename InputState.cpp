@@ -0,0 +1,47 @@
+#include "InputState.h"
+
+int InputState::HoldFrames(int key_code) const {
+	if (!cur.Test(key_code)) return 0;
+	for (int i = 0; i < heldCount; i++) {
+		if (heldKeys[i] == key_code) return heldFrames[i];
+	}
+	// ɉꂷĐĂȂL[
+	return 1;
+}
+
+void InputState::Advance(const KeyBits& now, double time) {
+	prev = cur;
+	cur = now;
+	for (int w = 0; w < 4; w++) {
+		down.words[w] = cur.words[w] & ~prev.words[w];
+		up.words[w] = prev.words[w] & ~cur.words[w];
+	}
+
+	// ĂL[̃t[i߁AL[
+	int kept = 0;
+	for (int i = 0; i < heldCount; i++) {
+		if (!cur.Test(heldKeys[i])) continue;
+		heldKeys[kept] = heldKeys[i];
+		heldFrames[kept] = heldFrames[i] + 1;
+		kept++;
+	}
+	heldCount = kept;
+
+	eventCount = 0;
+	ForEachSetBit(up, [&](int key) {
+		PushEvent(InputEvent::Type::Up, key, time);
+	});
+	ForEachSetBit(down, [&](int key) {
+		PushEvent(InputEvent::Type::Down, key, time);
+		if (heldCount < MAX_HELD_KEYS) {
+			heldKeys[heldCount] = (uint8_t)key;
+			heldFrames[heldCount] = 1;
+			heldCount++;
+		}
+	});
+}
+
+void InputState::PushEvent(InputEvent::Type type, int key, double time) {
+	if (eventCount == MAX_EVENTS) return;
+	events[eventCount++] = { type, (uint8_t)key, time };
+}
@@ -1,18 +1,90 @@
 #pragma once
-struct InputState{
-	int key[256];
-	int prevKey[256];
+#include <cstdint>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
-	bool IsKeyDown(int key_code)const
-	{
-		return key[key_code]>=1 && prevKey[key_code]==0;
-	}
-	bool IsKeyStay(int key_code)const
-	{
-		return key[key_code] >= 1 && prevKey[key_code] >= 1;
-	}
-	bool IsKeyUp(int key_code)const
-	{
-		return key[key_code] == 0 && prevKey[key_code] >= 1;
+// 256̃L[̉Ԃ1L[1rbgŎ (64rbg ~ 4)
+struct KeyBits {
+	uint64_t words[4] = {};
+
+	bool Test(int key) const { return (words[key >> 6] >> (key & 63)) & 1; }
+	void Set(int key) { words[key >> 6] |= 1ull << (key & 63); }
+	void Toggle(int key) { words[key >> 6] ^= 1ull << (key & 63); }
+	bool Any() const { return (words[0] | words[1] | words[2] | words[3]) != 0; }
+};
+
+// Ărbg̔ԍ fn(ԍ) ɓn
+template<class F>
+inline void ForEachSetBit(const KeyBits& bits, F&& fn) {
+	for (int w = 0; w < 4; w++) {
+		uint64_t word = bits.words[w];
+		while (word) {
+			int bit = 0;
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward64(&index, word);
+			bit = (int)index;
+#else
+			bit = __builtin_ctzll(word);
+#endif
+			fn(w * 64 + bit);
+			word &= word - 1;
+		}
 	}
-};
\ No newline at end of file
+}
+
+// L[EƂo
+struct InputEvent {
+	enum class Type : uint8_t {
+		Down,
+		Up,
+	};
+	Type type;
+	uint8_t key;		// KEY_INPUT_*
+	double time;		// o (GameManager ̃Q[v̕bBvCłlɂȂ)
+};
+
+// 1t[̃L[
+// Ԃ͍ƑÕrbg񂾂AE cur & ~prev ̂悤
+// 64rbgPʂł܂Ƃ߂ċ߂BĂt[͉ĂL[̕B
+// ̃t[ɉEL[́Ao (ȂL[ԍ) ɃCxgƂĂǂ߂
+class InputState {
+public:
+	// t[𐔂L[̐ (𒴂ēɉꂽL[͐Ȃ)
+	static const int MAX_HELD_KEYS = 16;
+	static const int MAX_EVENTS = 64;
+
+	// ̃t[ŉ
+	bool IsKeyDown(int key_code) const { return down.Test(key_code); }
+	// Õt[牟Ă
+	bool IsKeyStay(int key_code) const { return cur.Test(key_code) && prev.Test(key_code); }
+	// ̃t[ŗ
+	bool IsKeyUp(int key_code) const { return up.Test(key_code); }
+	// Ă (t[܂)
+	bool IsKeyHeld(int key_code) const { return cur.Test(key_code); }
+	// Ăt[ (t[ 1BĂȂ 0)
+	int HoldFrames(int key_code) const;
+
+	// ̃t[̃Cxg
+	int EventCount() const { return eventCount; }
+	const InputEvent& Event(int i) const { return events[i]; }
+
+	const KeyBits& Current() const { return cur; }
+
+	// ̃L[̏ now  time ɌoƂ1t[i߂ (GameManager t[Ă)
+	void Advance(const KeyBits& now, double time);
+
+private:
+	KeyBits cur, prev;
+	KeyBits down, up;	// cur & ~prev, prev & ~cur
+
+	uint8_t heldKeys[MAX_HELD_KEYS] = {};
+	int heldFrames[MAX_HELD_KEYS] = {};
+	int heldCount = 0;
+
+	InputEvent events[MAX_EVENTS] = {};
+	int eventCount = 0;
+
+	void PushEvent(InputEvent::Type type, int key, double time);
+};
@@ -1,14 +1,33 @@
 #include "DxLib.h"
 #include "GameManager.h"
 #include "GameData.h"
+#include <sstream>
+#include <string>
 
-int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
+// R}hC --record <t@C> / --replay <t@C> ǂ
+// (--record ͓͂ƃXebvL^A--replay ͋L^͂œʂČ)
+static void ApplyCommandLine(GameManager& gameManager, const char* commandLine)
+{
+	std::istringstream args(commandLine ? commandLine : "");
+	std::string option, path;
+	while (args >> option) {
+		if ((option == "--record" || option == "--replay") && args >> path) {
+			const bool ok = (option == "--record")
+				? gameManager.StartRecording(path.c_str())
+				: gameManager.StartReplay(path.c_str());
+			if (!ok) printfDx("%s %s J܂ł\n", option.c_str(), path.c_str());
+		}
+	}
+}
+
+int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR lpCmdLine, int)
 {
 	ChangeWindowMode(TRUE);
 	SetGraphMode(GameData::windowWidth, GameData::windowHeight, 32);
 	GameManager gameManager; // GameManagerIuWFNg𐶐
 
 	gameManager.Initialize(); // Q[̏
+	ApplyCommandLine(gameManager, lpCmdLine);
 
 	// Q[[v
 	while (ProcessMessage() == 0 && CheckHitKey(KEY_INPUT_ESCAPE) == 0
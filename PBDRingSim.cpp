@@ -1,212 +1,39 @@
 #include "PBDRingSim.h"
+#include "InputBinding.h"
 
-PBDRingSim::PBDRingSim()
-	:nodeCount(10), pointRadius(50), circleRadius(5)
-	, startX(0), startY(0), moveSpeed(5), segmentLength(0)
+PBDRingSim::PBDRingSim(PhysicsWorld& world)
+	:core(world.CreateBody<PBDRingCore>(GameData::windowWidth / 2, GameData::windowHeight / 2)), circleRadius(5)
 {
-	startX = GameData::windowWidth / 2;
-	startY = GameData::windowHeight / 2;
-	nodeColor = GetColor(255, 255, 255);
-
-	//m[h~ɔzu
-	float oneStep = (2 * DX_PI_F) / nodeCount;
-	//Sm[h쐬
-	middleNode = { startX,startY };
-	for (int i = 0; i < nodeCount; i++) {
-		Vec2f node = { startX + cos(oneStep * i - DX_PI_F / 2) * pointRadius,
-						  startY + sin(oneStep * i - DX_PI_F / 2) * pointRadius };
-		nodes.push_back(node);
-	}
-	/*for (int i = 0; i < nodeCount; i++) {
-		nodes.push_back({ startX,startY + 10 * i });
-	}*/
-	Vec2f diff = nodes[0] - nodes[1];
-	segmentLength = diff.length();
+	nodeColor = GetColorU8(255, 255, 255, 255);
+	lineColor = GetColorU8(255, 255, 255, 255);
+	//`悵~̑傫ő̃O`F[ƂԂ
+	core->collisionRadius = circleRadius;
 }
 
 void PBDRingSim::Update(const InputState* input) {
-	Vec2f& topNode = middleNode;
-	float moveValX = 0;
-	float moveValY = 0;
-	if (input->IsKeyStay(KEY_INPUT_A)) {
-		topNode.x -= moveSpeed;
-		moveValX -= moveSpeed;
-	}
-	if (input->IsKeyStay(KEY_INPUT_D)) {
-		topNode.x += moveSpeed;
-		moveValX += moveSpeed;
-	}
-	if (input->IsKeyStay(KEY_INPUT_W)) {
-		topNode.y -= moveSpeed;
-		moveValY -= moveSpeed;
-	}
-	if (input->IsKeyStay(KEY_INPUT_S)) {
-		topNode.y += moveSpeed;
-		moveValY += moveSpeed;
-	}
-
-	//eړem[h̗zʒuɓ`
-
-	for (int i = 0; i < testCount; i++) {
-		UpdateNodesWithRing();
-		UpdateNodesAround();
-		//UpdateNodesLine();
-		BarrierHit();
-	}
-}
-
-void PBDRingSim::UpdateNodesWithRing() {
-	for (int i = 0; i < nodes.size(); i++) {
-		Vec2f& p1 = nodes[i];
-		Vec2f& p2 = middleNode;
-
-		//node0node1̃xNgƂ̒擾
-		Vec2f diff = p1 - p2;
-		float currentDist = diff.length();
-
-		//CʁFnode0node1Ƃ̋͗z̋ł͂ȂȂ̂ŏC
-		/*
-		DQ̃|Cg̋ƂB
-		diff͂Q̃|CgԂ̃xNg܂
-		diff/D̓xNg̑傫ŊĂ̂ŒPʃxNgɂȂ
-		̒PʃxNgdiff/DɎۂɈړ(D-L)
-		L͂Q̃|Cg̗zIȋ
-		diff/D * (D-L)=diff * (D-L)/DƏ̂ŁA(D-L)/D̎KvȂ̂
-		*/
-
-		float correctFactor = (currentDist - pointRadius) / currentDist;
-		Vec2f correctVector = diff * correctFactor;
-
-		//p2(node0)p1(node1)ւ̃xNgdiffȂ̂ŁAp1p2͋txNgɂȂ
-		//Ȃ̂ŁAp1ɑ΂Ă̓}CiXɂȂ
-		if (!changeVersion) {
-			p1 = p1 - correctVector * 0.5f;
-			/*if (i == 1) {
-				p1 = p1 - correctVector;
-			}
-			else {
-				p1 = p1 - correctVector * 0.5f;
-				p2 = p2 + correctVector * 0.5f;
-			}*/
-		}
-		else {
-			p1 = p1 - correctVector;
-		}
-
-	}
-}
-
-void PBDRingSim::UpdateNodesAround() {
-	for (int i = 1; i <= nodes.size(); i++) {
-		Vec2f& p1 = nodes[i % nodes.size()];
-		Vec2f& p2 = nodes[i - 1];
-
-		//node0node1̃xNgƂ̒擾
-		Vec2f diff = p1 - p2;
-		float currentDist = diff.length();
-
-		//CʁFnode0node1Ƃ̋͗z̋ł͂ȂȂ̂ŏC
-		/*
-		DQ̃|Cg̋ƂB
-		diff͂Q̃|CgԂ̃xNg܂
-		diff/D̓xNg̑傫ŊĂ̂ŒPʃxNgɂȂ
-		̒PʃxNgdiff/DɎۂɈړ(D-L)
-		L͂Q̃|Cg̗zIȋ
-		diff/D * (D-L)=diff * (D-L)/DƏ̂ŁA(D-L)/D̎KvȂ̂
-		*/
-
-		float correctFactor = (currentDist - segmentLength) / currentDist;
-		Vec2f correctVector = diff * correctFactor;
-
-		//p2(node0)p1(node1)ւ̃xNgdiffȂ̂ŁAp1p2͋txNgɂȂ
-		//Ȃ̂ŁAp1ɑ΂Ă̓}CiXɂȂ
-		if (!changeVersion) {
-			p1 = p1 - correctVector * 0.5f;
-			p2 = p2 + correctVector * 0.5f;
-			/*if (i == 1) {
-				p1 = p1 - correctVector;
-			}
-			else {
-				p1 = p1 - correctVector * 0.5f;
-				p2 = p2 + correctVector * 0.5f;
-			}*/
-		}
-		else {
-			p1 = p1 - correctVector;
-		}
-
-	}
-}
-
-void PBDRingSim::UpdateNodeIdealPos() {
-	for (int i = 0; i < nodes.size(); i++) {
-
-	}
-}
-
-void PBDRingSim::UpdateNodesLine() {
-	for (int i = 1; i < nodes.size(); i++) {
-		Vec2f& p1 = nodes[i % nodes.size()];
-		Vec2f& p2 = nodes[i];
-
-		//node0node1̃xNgƂ̒擾
-		Vec2f diff = p1 - p2;
-		float currentDist = diff.length();
-
-		float correctFactor = (currentDist - segmentLength) / currentDist;
-		Vec2f correctVector = diff * correctFactor;
-
-		if (!changeVersion) {
-			if (i == 1) {
-				p1 = p1 - correctVector;
-			}
-			else {
-				p1 = p1 - correctVector * 0.5f;
-				p2 = p2 + correctVector * 0.5f;
-			}
-		}
-		else {
-			p1 = p1 - correctVector;
-		}
-
-	}
+	core->SetControl(MakeBodyControl(input));
 }
 
-void PBDRingSim::BarrierHit() {
-	if (middleNode.y > 700)middleNode.y = 700;
-	for (int i = 0; i < nodes.size(); i++) {
-		if (nodes[i].y > 700) {
-			nodes[i].y = 700;
-		}
-	}
-}
-
-void PBDRingSim::Draw() {
-	int color = GetColor(255, 255, 255);
-	if (changeVersion)color = GetColor(0, 255, 0);
-	//DrawCircle(startX, startY, 10, GetColor(0, 0, 0), TRUE);
+void PBDRingSim::Draw(const WorldSnapshot& snapshot, PrimitiveBatch& batch, float alpha) {
+	const SnapshotBody* nodes = snapshot.Find(core);
+	if (nodes == nullptr) return;
+	const int middle = core->MiddleIndex();
+	int nodeCount = core->NodeCount();
 
 	//Sm[h`
-	DrawCircle(middleNode.x, middleNode.y, circleRadius, nodeColor, TRUE);
+	Vec2f middlePos = snapshot.Interpolated(*nodes, middle, alpha);
+	batch.AddCircle(middlePos, circleRadius, nodeColor);
 
 	//em[h`
-	for (int i = 0; i < nodes.size(); i++) {
-		DrawCircle(nodes[i].x, nodes[i].y, circleRadius, nodeColor, TRUE);
+	for (int i = 0; i < nodeCount; i++) {
+		Vec2f pos = snapshot.Interpolated(*nodes, i, alpha);
+		batch.AddCircle(pos, circleRadius, nodeColor);
 	}
-	//em[h̗zʒu`
-	/*for (int i = 0; i < nodes.size(); i++) {
-		DrawCircle(nodes[i].ideal_x, nodes[i].ideal_y, circleRadius, GetColor(0, 255, 0), TRUE);
-	}*/
 	//m[hȂ`
-	for (int i = 0; i < nodes.size(); i++) {
+	for (int i = 0; i < nodeCount; i++) {
 		int next = (i + 1) % nodeCount;
-		DrawLine(nodes[i].x, nodes[i].y, nodes[next].x, nodes[next].y,
-			GetColor(255, 255, 255), 5);
+		Vec2f pos = snapshot.Interpolated(*nodes, i, alpha);
+		Vec2f nextPos = snapshot.Interpolated(*nodes, next, alpha);
+		batch.AddLine(pos, nextPos, 5.0f, lineColor);
 	}
-	/*for (int i = 0; i < nodes.size() - 1; i++) {
-		int next = (i + 1) % nodeCount;
-		DrawLine(nodes[i].x, nodes[i].y, nodes[next].x, nodes[next].y,
-			GetColor(255, 255, 255), 5);
-	}*/
 }
-
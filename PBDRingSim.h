@@ -1,49 +1,24 @@
 #pragma once
 #include "DxLib.h"
-#include "StringPointManager.h"
 #include "GameData.h"
 #include "InputState.h"
-#include <cmath>
-#include <vector>
-
-//struct Vec2F {
-//	float x;
-//	float y;
-//
-//	Vec2F operator+(const Vec2F& other)const { return { x + other.x,y + other.y }; }
-//	Vec2F operator-(const Vec2F& other)const { return { x - other.x,y - other.y }; }
-//	Vec2F operator*(const float v)const { return { x * v,y * v }; }
-//
-//	float lengthSq()const { return x * x + y * y; }
-//	float length()const { return std::sqrt(lengthSq()); }
-//};
+#include "PrimitiveBatch.h"
+#include "PhysicsCore/PBDRingCore.h"
+#include "PhysicsCore/PhysicsWorld.h"
 
+// PBDRingCore ̕`A_v^ (vZ PhysicsCore )
+// RA PhysicsWorld AXebv PhysicsWorld::Step Ői߂
 class PBDRingSim {
 public:
-	PBDRingSim();
+	PBDRingSim(PhysicsWorld& world);
+	//͂RAɓn (Xebv͐i߂Ȃ)
 	void Update(const InputState* input);
-	void Draw();
-	bool changeVersion = false;
-	int testCount = 3;
-	int nodeColor = 0;
+	//snapshot: `[h̏ batch: ~Ɛ߂ alpha: O̕Xebv̕ԗ (0`1)
+	void Draw(const WorldSnapshot& snapshot, PrimitiveBatch& batch, float alpha = 1.0f);
+	PBDRingCore& Core() { return *core; }
+	COLOR_U8 nodeColor;
+	COLOR_U8 lineColor;
 private:
-	std::vector<Vec2f> nodes;
-	Vec2f middleNode;
-	int nodeCount;
-	float pointRadius;			//S̔a
+	PBDRingCore* core;			//PhysicsWorld 
 	float circleRadius;			//m[h`掞circlea
-	float startX, startY;
-	float moveSpeed;
-	float segmentLength;		//em[hԂ̗zIȋ
-
-	//Sm[hƊem[h𒲐鏈
-	void UpdateNodesWithRing();
-	//SẴm[ĥ悤ɂȂĂ
-	void UpdateNodesLine();
-	//Sm[hȊÕm[h~ɂȂ悤ɋ𒲐鏈
-	void UpdateNodesAround();
-	//w肵ʒuɐi܂Ȃ悤ɂ鏈
-	void BarrierHit();
-	//em[h̒Aem[h̗zʒup
-	void UpdateNodeIdealPos();
-};
\ No newline at end of file
+};
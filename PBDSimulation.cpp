@@ -1,129 +1,32 @@
 #include "PBDSimulation.h"
+#include "InputBinding.h"
 
-PBDSimulation::PBDSimulation()
-	:nodeCount(10), pointRadius(100), circleRadius(5)
-	, startX(0), startY(0), moveSpeed(1), segmentLength(30)
+PBDSimulation::PBDSimulation(PhysicsWorld& world)
+	:core(world.CreateBody<PBDChainCore>(GameData::windowWidth / 2, GameData::windowHeight / 2)), circleRadius(5)
 {
-	startX = GameData::windowWidth / 2;
-	startY = GameData::windowHeight / 2;
-	nodeColor = GetColor(255, 255, 255);
-
-	//m[h~ɔzu
-	float oneStep = (2 * DX_PI_F) / nodeCount;
-	for (int i = 0; i < nodeCount; i++) {
-		nodes.push_back({ startX + cos(oneStep * i - DX_PI_F / 2) * pointRadius,
-						  startY + sin(oneStep * i - DX_PI_F / 2) * pointRadius });
-	}
-	/*for (int i = 0; i < nodeCount; i++) {
-		nodes.push_back({ startX,startY + 10 * i });
-	}*/
+	nodeColor = GetColorU8(255, 255, 255, 255);
+	lineColor = GetColorU8(255, 255, 255, 255);
+	//`悵~̑傫ő̃O`F[ƂԂ
+	core->collisionRadius = circleRadius;
 }
 
 void PBDSimulation::Update(const InputState* input) {
-	Vec2f& topNode = nodes[0];
-	if (input->IsKeyStay(KEY_INPUT_A)) {
-		topNode.x -= moveSpeed;
-	}
-	if (input->IsKeyStay(KEY_INPUT_D)) {
-		topNode.x += moveSpeed;
-	}
-	if (input->IsKeyStay(KEY_INPUT_W)) {
-		topNode.y -= moveSpeed;
-	}
-	if (input->IsKeyStay(KEY_INPUT_S)) {
-		topNode.y += moveSpeed;
-	}
-
-	for (int i = 0; i < testCount; i++) {
-		UpdateNodesWithRing();
-		//UpdateNodesLine();
-	}
+	core->SetControl(MakeBodyControl(input));
 }
 
-void PBDSimulation::UpdateNodesLine() {
-	for (int i = 1; i < nodes.size(); i++) {
-		Vec2f& p1 = nodes[i % nodes.size()];
-		Vec2f& p2 = nodes[i - 1];
-
-		//node0node1̃xNgƂ̒擾
-		Vec2f diff = p1 - p2;
-		float currentDist = diff.length();
-
-		float correctFactor = (currentDist - segmentLength) / currentDist;
-		Vec2f correctVector = diff * correctFactor;
+void PBDSimulation::Draw(const WorldSnapshot& snapshot, PrimitiveBatch& batch, float alpha) {
+	const SnapshotBody* nodes = snapshot.Find(core);
+	if (nodes == nullptr) return;
+	int nodeCount = core->NodeCount();
 
-		if (!changeVersion) {
-			if (i == 1) {
-				p1 = p1 - correctVector;
-			}
-			else {
-				p1 = p1 - correctVector * 0.5f;
-				p2 = p2 + correctVector * 0.5f;
-			}
-		}
-		else {
-			p1 = p1 - correctVector;
-		}
-
-	}
-}
-
-void PBDSimulation::UpdateNodesWithRing() {
-	for (int i = 1; i <= nodes.size(); i++) {
-		Vec2f& p1 = nodes[i % nodes.size()];
-		Vec2f& p2 = nodes[i - 1];
-
-		//node0node1̃xNgƂ̒擾
-		Vec2f diff = p1 - p2;
-		float currentDist = diff.length();
-
-		//CʁFnode0node1Ƃ̋͗z̋ł͂ȂȂ̂ŏC
-		/*
-		DQ̃|Cg̋ƂB
-		diff͂Q̃|CgԂ̃xNg܂
-		diff/D̓xNg̑傫ŊĂ̂ŒPʃxNgɂȂ
-		̒PʃxNgdiff/DɎۂɈړ(D-L)
-		L͂Q̃|Cg̗zIȋ
-		diff/D * (D-L)=diff * (D-L)/DƏ̂ŁA(D-L)/D̎KvȂ̂
-		*/
-
-		float correctFactor = (currentDist - segmentLength) / currentDist;
-		Vec2f correctVector = diff * correctFactor;
-
-		//p2(node0)p1(node1)ւ̃xNgdiffȂ̂ŁAp1p2͋txNgɂȂ
-		//Ȃ̂ŁAp1ɑ΂Ă̓}CiXɂȂ
-		if (!changeVersion) {
-			if (i == 1) {
-				p1 = p1 - correctVector;
-			}
-			else {
-				p1 = p1 - correctVector * 0.5f;
-				p2 = p2 + correctVector * 0.5f;
-			}
-		}
-		else {
-			p1 = p1 - correctVector;
-		}
-
-	}
-}
-
-void PBDSimulation::Draw() {
-	int color = GetColor(255, 255, 255);
-	if (changeVersion)color = GetColor(0, 255, 0);
-	//DrawCircle(startX, startY, 10, GetColor(0, 0, 0), TRUE);
-	for (int i = 0; i < nodes.size(); i++) {
-		DrawCircle(nodes[i].x, nodes[i].y, circleRadius, nodeColor, TRUE);
+	for (int i = 0; i < nodeCount; i++) {
+		Vec2f pos = snapshot.Interpolated(*nodes, i, alpha);
+		batch.AddCircle(pos, circleRadius, nodeColor);
 	}
-	for (int i = 0; i < nodes.size(); i++) {
+	for (int i = 0; i < nodeCount; i++) {
 		int next = (i + 1) % nodeCount;
-		DrawLine(nodes[i].x, nodes[i].y, nodes[next].x, nodes[next].y,
-			GetColor(255, 255, 255), 5);
+		Vec2f pos = snapshot.Interpolated(*nodes, i, alpha);
+		Vec2f nextPos = snapshot.Interpolated(*nodes, next, alpha);
+		batch.AddLine(pos, nextPos, 5.0f, lineColor);
 	}
-	/*for (int i = 0; i < nodes.size() - 1; i++) {
-		int next = (i + 1) % nodeCount;
-		DrawLine(nodes[i].x, nodes[i].y, nodes[next].x, nodes[next].y,
-			GetColor(255, 255, 255), 5);
-	}*/
 }
-
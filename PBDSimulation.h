@@ -1,40 +1,24 @@
 #pragma once
 #include "DxLib.h"
-#include "StringPointManager.h"
 #include "GameData.h"
 #include "InputState.h"
-#include <cmath>
-#include <vector>
-
-//struct Vec2F {
-//	float x;
-//	float y;
-//
-//	Vec2F operator+(const Vec2F& other)const { return { x + other.x,y + other.y }; }
-//	Vec2F operator-(const Vec2F& other)const { return { x - other.x,y - other.y }; }
-//	Vec2F operator*(const float v)const { return { x * v,y * v }; }
-//
-//	float lengthSq()const { return x * x + y * y; }
-//	float length()const { return std::sqrt(lengthSq()); }
-//};
+#include "PrimitiveBatch.h"
+#include "PhysicsCore/PBDChainCore.h"
+#include "PhysicsCore/PhysicsWorld.h"
 
+// PBDChainCore ̕`A_v^ (vZ PhysicsCore )
+// RA PhysicsWorld AXebv PhysicsWorld::Step Ői߂
 class PBDSimulation {
 public:
-	PBDSimulation();
+	PBDSimulation(PhysicsWorld& world);
+	//͂RAɓn (Xebv͐i߂Ȃ)
 	void Update(const InputState* input);
-	void Draw();
-	bool changeVersion = false;
-	int testCount = 4;
-	int nodeColor = 0;
+	//snapshot: `[h̏ batch: ~Ɛ߂ alpha: O̕Xebv̕ԗ (0`1)
+	void Draw(const WorldSnapshot& snapshot, PrimitiveBatch& batch, float alpha = 1.0f);
+	PBDChainCore& Core() { return *core; }
+	COLOR_U8 nodeColor;
+	COLOR_U8 lineColor;
 private:
-	std::vector<Vec2f> nodes;
-	int nodeCount;
-	float pointRadius;
+	PBDChainCore* core;	//PhysicsWorld 
 	float circleRadius;
-	float startX, startY;
-	float moveSpeed;
-	float segmentLength;
-
-	void UpdateNodesWithRing();
-	void UpdateNodesLine();
-};
\ No newline at end of file
+};
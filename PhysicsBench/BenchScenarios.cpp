@@ -0,0 +1,79 @@
+#include "BenchScenarios.h"
+#include "PBDChainCore.h"
+#include "PBDRingCore.h"
+#include "PopRingCore.h"
+#include "RopeCore.h"
+#include "SpringCore.h"
+#include "SpringGravityCore.h"
+
+namespace {
+	// Q[̉ʂ̑傫 (GameData  DxLib Ɉˑ̂Œlʂ)
+	const float WINDOW_WIDTH = 1280.0f;
+	const float WINDOW_HEIGHT = 720.0f;
+	// ̂ɕׂԊu
+	const float SPACING = 220.0f;
+
+	const char* const NAMES[] = {
+		"ring", "chain", "popring", "rope", "spring", "springgravity", nullptr,
+	};
+
+	int Or(int value, int fallback) {
+		return (value > 0) ? value : fallback;
+	}
+
+	// i Ԗڂ̂̕uʒu (ʂ̒𒆐Sɕׂ)
+	float OffsetX(int i, int count) {
+		return (i - (count - 1) * 0.5f) * SPACING;
+	}
+}
+
+bool CreateScenario(const std::string& name, PhysicsWorld& world, const BenchConfig& config) {
+	// InGameState::BuildLevel Ɠ (x ǂł y = 700 艺ɂ͐i߂Ȃ)
+	const float farAway = 1.0e9f;
+	world.Statics().AddBox({ -farAway, 700.0f }, { farAway, farAway });
+
+	const int count = (config.bodies < 1) ? 1 : config.bodies;
+	for (int i = 0; i < count; i++) {
+		const float x = WINDOW_WIDTH / 2 + OffsetX(i, count);
+		const float y = WINDOW_HEIGHT / 2;
+		if (name == "ring") {
+			// PBDRingSim
+			PBDRingCore* core = world.CreateBody<PBDRingCore>(x, y, Or(config.nodes, 10));
+			core->collisionRadius = 5;
+			core->testCount = Or(config.iterations, core->testCount);
+		}
+		else if (name == "chain") {
+			// PBDSimulation
+			PBDChainCore* core = world.CreateBody<PBDChainCore>(x, y, Or(config.nodes, 10));
+			core->collisionRadius = 5;
+			core->testCount = Or(config.iterations, core->testCount);
+		}
+		else if (name == "popring") {
+			// PopRingManager
+			PopRingCore* core = world.CreateBody<PopRingCore>(Or(config.nodes, 16), 50.0f, Vec2F{ x, y });
+			core->SetCollisionRadius(3.0f);
+			if (config.iterations > 0) core->SetIterations(config.iterations);
+		}
+		else if (name == "rope") {
+			// StringPointManager (InGameState ƓE)
+			RopeCore* core = world.CreateBody<RopeCore>(x, 100.0f, Or(config.nodes, 10), 15.0f, 200.0f, 300.0f);
+			if (config.iterations > 0) core->SetIterations(config.iterations);
+		}
+		else if (name == "spring") {
+			// SpringManager (m[hƔ񐔂͂Ȃ)
+			world.CreateBody<SpringCore>();
+		}
+		else if (name == "springgravity") {
+			// SpringAndGravityManager
+			world.CreateBody<SpringGravityCore>();
+		}
+		else {
+			return false;
+		}
+	}
+	return true;
+}
+
+const char* const* ScenarioNames() {
+	return NAMES;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "PhysicsWorld.h"
+#include <string>
+
+// x`}[N̏
+struct BenchConfig {
+	int bodies = 1;			// ̂ׂ邩
+	int nodes = 0;			// 1̂̃m[h (0 ȂQ[Ɠl)
+	int iterations = 0;		// 1Xebv̔ (0 ȂQ[Ɠl)
+};
+
+// Q[̊e Manager / Sim [hɍ镨̂AݒŃ[hɍ
+// (`L[͂̕͏)BmȂOȂ false Ԃ
+bool CreateScenario(const std::string& name, PhysicsWorld& world, const BenchConfig& config);
+
+// CreateScenario mĂ閼Öꗗ (nullptr ŏI)
+const char* const* ScenarioNames();
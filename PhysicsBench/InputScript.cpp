@@ -0,0 +1,59 @@
+#include "InputScript.h"
+#include <cctype>
+#include <sstream>
+
+bool InputScript::Parse(const std::string& text, std::string& error) {
+	segments.clear();
+	length = 0;
+
+	std::istringstream stream(text);
+	std::string token;
+	while (stream >> token) {
+		const size_t colon = token.find(':');
+		if (colon == std::string::npos || colon == 0 || colon + 1 == token.size()) {
+			error = "\"" + token + "\"  L[:t[ ̌`ł͂Ȃ";
+			return false;
+		}
+
+		Segment segment;
+		const std::string keys = token.substr(0, colon);
+		if (keys != "-") {
+			for (char c : keys) {
+				switch (std::toupper((unsigned char)c)) {
+				case 'W': segment.control.up = true; break;
+				case 'A': segment.control.left = true; break;
+				case 'S': segment.control.down = true; break;
+				case 'D': segment.control.right = true; break;
+				default:
+					error = "\"" + token + "\"  WASD ȊÕL[";
+					return false;
+				}
+			}
+		}
+
+		const std::string count = token.substr(colon + 1);
+		segment.frames = 0;
+		for (char c : count) {
+			if (!std::isdigit((unsigned char)c)) {
+				error = "\"" + token + "\" ̃t[łȂ";
+				return false;
+			}
+			segment.frames = segment.frames * 10 + (c - '0');
+		}
+		if (segment.frames == 0) continue;
+
+		segments.push_back(segment);
+		length += segment.frames;
+	}
+	return true;
+}
+
+BodyControl InputScript::At(int frame) const {
+	if (length == 0) return BodyControl();
+	int remaining = frame % length;
+	for (const Segment& segment : segments) {
+		if (remaining < segment.frames) return segment.control;
+		remaining -= segment.frames;
+	}
+	return BodyControl();
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "BodyControl.h"
+#include <string>
+#include <vector>
+
+// x`}[Np̓͂̑{
+// "D:120 W:60 -:30" ̂悤ɁuĂL[:t[v󔒋؂ŕׂB
+// L[ W / A / S / D ̑gݍ킹 ( "DW:60")AȂt[ "-"B
+// {̍Ō܂Ői񂾂擪ɖ߂ (t[̍v蒷񂵂Ă͂JԂ)
+//
+// Q[ł InputState  MakeBodyControl  BodyControl ɕϊĕ̂ɓn̂ŁA
+// ł DxLib ̃L[R[hoR BodyControl 𒼐ڍ
+class InputScript {
+public:
+	// ǂ߂ȂƂ false ԂAerror ɗR
+	bool Parse(const std::string& text, std::string& error);
+
+	// frame Ԗ (0 ) ̃t[̓
+	BodyControl At(int frame) const;
+
+	// {1̃t[
+	int Length() const { return length; }
+
+private:
+	struct Segment {
+		BodyControl control;
+		int frames;
+	};
+	std::vector<Segment> segments;
+	int length = 0;
+};
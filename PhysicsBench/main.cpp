@@ -0,0 +1,572 @@
+#include "BenchScenarios.h"
+#include "DistanceConstraints.h"
+#include "InputScript.h"
+#include "SimdSupport.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// RA𓮂wbhX̃x`}[N
+// Q[̊e Manager 镨̂A{̓͂Ō܂t[i߁A
+// 1XebvE1m[hE1񂠂̎Ԃ JSON  CSV ŏo͂B
+//
+//   PhysicsBench --scenario all --frames 600 --nodes 64 --iterations 8 --script "D:120 W:60"
+//
+// ͂ԍ݂ŒȂ̂ŁAȂ疈񓯂 (checksum) ɂȂ
+//
+// --compare-simd 1 ł͎Ԃ𑪂ɁAViIXJ[ SIMD ̃J[lŐi߂ĈʒuׂB
+// Xebv̎_ŋ1񂾂 ConstraintKernels.h ɏ𒴂 1 ԂB
+// Xebvd˂ (Ô) ͏Ȃ̂ŁAo͂邾Ŕɂ͎gȂ
+//
+// --check-determinism 1 ł́AViI[J[12ƁA[J[ N  (--threadsBȂ 4) Ői߁A
+// t[ StateHash  checksum ǂvȂ 1 Ԃ (vCvO̊mF)B
+// ̂1ƕɉƂ낪Ȃ̂ŁA--bodies ő₵Ďg
+
+namespace {
+	struct Options {
+		std::string scenario = "all";
+		int frames = 600;
+		int warmup = 60;			// vOɐi߂t[
+		int threads = 0;			// JobSystem ̃[J[ (0 Ȃn[hEFAɍ킹)
+		int subSteps = 1;
+		int sleep = 1;				// ~܂̂𖰂点邩 (0 Ȃ疈XebvŜ)
+		float tolerance = -1.0f;	// ł؂ᔽ̑傫 (pxBȂ烏[h̊l)
+		int budgetUs = 0;			// 1XebvŔɎgĂ悢 (0 Ȃ琧Ȃ)
+		float dt = 1.0f / 60.0f;
+		std::string script = "D:120 W:60 A:120 S:60 -:60";
+		std::string format = "json";
+		std::string out;			// ȂWo
+		int compareSimd = 0;		// Ԃ𑪂ɃXJ[ SIMD ̈ʒuׂ邩
+		int checkDeterminism = 0;	// Ԃ𑪂ɁAJԂ⃏[J[ŌʂςȂ𒲂ׂ邩
+		BenchConfig config;
+	};
+
+	struct Result {
+		std::string scenario;
+		int bodies = 0;
+		int nodes = 0;
+		int constraints = 0;
+		int iterations = 0;			// ̂1Xebvɉ񂷔񐔂̏ (̂ƂɈႦ΍ő)
+		double totalMs = 0;
+		double nsPerStep = 0;
+		double nsPerNode = 0;
+		double nsPerConstraint = 0;
+		double p50 = 0;				// 1Xebv̎Ԃ̒l (ns)
+		double p99 = 0;
+		double checksum = 0;		// Ō̕`p̓_̈ʒu̍v (ʂςĂȂ̊mFp)
+		int sleeping = 0;			// ŌɖĂ̂̐
+		double avgIterations = 0;	// NĂ1E1XebvɎۂɉ񂵂񐔂̕
+		double maxError = 0;		// v̐̈ᔽ̍ő (px)
+	};
+
+	// --compare-simd ̌ (XJ[̌ʂƂ̍Bpx)
+	struct CompareResult {
+		std::string scenario;
+		SimdLevel simd = SimdLevel::Scalar;
+		double correctionDiff = 0;	// 1񂾂Ƃ̍̍ő
+		double correctionRatio = 0;	// ̍Ŋl̍ő (1 𒴂玸s)
+		double stepDiff = 0;		// XebvԂ1Xebv SIMD Ői߂Ƃ̍̍ő
+		double finalDiff = 0;		// SIMD ŐiߑŌ̍ (Ô)
+		bool passed = true;
+	};
+
+	// --check-determinism ̌
+	struct DeterminismResult {
+		std::string scenario;
+		int threads = 0;			// [J[1̌ʂƔׂ[J[
+		uint32_t hash = 0;			// Ō̃t[ StateHash ([J[11)
+		double checksum = 0;		// `p̓_̈ʒu̍v
+		int repeatMismatch = -1;	// 2ڂHŏ̃t[ (-1 ȂŌ܂ňv)
+		int threadMismatch = -1;	// [J[ς̂Hŏ̃t[
+		bool passed = true;
+	};
+
+	void PrintUsage() {
+		std::fprintf(stderr,
+			"usage: PhysicsBench [options]\n"
+			"  --scenario NAME     ring / chain / popring / rope / spring / springgravity / all\n"
+			"  --frames N          vt[ ( 600)\n"
+			"  --warmup N          v̑Oɐi߂t[ ( 60)\n"
+			"  --bodies N          ̂̐ ( 1)\n"
+			"  --nodes N           1̂̃m[h (̓Q[Ɠ)\n"
+			"  --iterations N       (̓Q[Ɠ)\n"
+			"  --substeps N        PhysicsWorld ̃TuXebv ( 1)\n"
+			"  --threads N         [J[Xbh (̓n[hEFAɍ킹)\n"
+			"  --sleep 0|1         ~܂̂𖰂点邩 ( 1)\n"
+			"  --tolerance PX      ᔽȉɂȂ甽߂ (0 Ȃł؂ȂB̓[h̒l)\n"
+			"  --budget-us N       1XebvŔɎgĂ悢 ( 0 = Ȃ)\n"
+			"  --script TEXT       ͂̑{ ( \"D:120 W:60 -:30\")\n"
+			"  --format json|csv   o͂̌` ( json)\n"
+			"  --out PATH          o͐ (͕Wo)\n"
+			"  --compare-simd 0|1  Ԃ̑ɃXJ[ SIMD ̈ʒu̍o (点AԂ̗\ZȂ)\n"
+			"                      1̏C̍𒴂IR[h 1\n"
+			"  --check-determinism 0|1\n"
+			"                      Ԃ̑ɁA[J[12ƃ[J[ N  (--threadsB 4) Ői߂ʂׂ\n"
+			"                      (Ԃ̗\Z͂Ȃ)BStateHash  checksum HIR[h 1\n");
+	}
+
+	bool ParseInt(const char* text, int& value) {
+		char* end = nullptr;
+		const long parsed = std::strtol(text, &end, 10);
+		if (end == text || *end != '\0' || parsed < 0) return false;
+		value = (int)parsed;
+		return true;
+	}
+
+	bool ParseFloat(const char* text, float& value) {
+		char* end = nullptr;
+		const float parsed = std::strtof(text, &end);
+		if (end == text || *end != '\0' || parsed < 0) return false;
+		value = parsed;
+		return true;
+	}
+
+	bool ParseOptions(int argc, char** argv, Options& options) {
+		for (int i = 1; i < argc; i++) {
+			const std::string key = argv[i];
+			if (key == "--help" || key == "-h") return false;
+			if (i + 1 >= argc) {
+				std::fprintf(stderr, "%s ̒lȂ\n", key.c_str());
+				return false;
+			}
+			const char* value = argv[++i];
+			bool ok = true;
+			if (key == "--scenario") options.scenario = value;
+			else if (key == "--frames") ok = ParseInt(value, options.frames);
+			else if (key == "--warmup") ok = ParseInt(value, options.warmup);
+			else if (key == "--bodies") ok = ParseInt(value, options.config.bodies);
+			else if (key == "--nodes") ok = ParseInt(value, options.config.nodes);
+			else if (key == "--iterations") ok = ParseInt(value, options.config.iterations);
+			else if (key == "--substeps") ok = ParseInt(value, options.subSteps);
+			else if (key == "--threads") ok = ParseInt(value, options.threads);
+			else if (key == "--sleep") ok = ParseInt(value, options.sleep);
+			else if (key == "--tolerance") ok = ParseFloat(value, options.tolerance);
+			else if (key == "--budget-us") ok = ParseInt(value, options.budgetUs);
+			else if (key == "--script") options.script = value;
+			else if (key == "--format") {
+				options.format = value;
+				ok = (options.format == "json" || options.format == "csv");
+			}
+			else if (key == "--out") options.out = value;
+			else if (key == "--compare-simd") ok = ParseInt(value, options.compareSimd);
+			else if (key == "--check-determinism") ok = ParseInt(value, options.checkDeterminism);
+			else {
+				std::fprintf(stderr, "mȂIvV %s\n", key.c_str());
+				return false;
+			}
+			if (!ok) {
+				std::fprintf(stderr, "%s ̒l \"%s\" Ȃ\n", key.c_str(), value);
+				return false;
+			}
+		}
+		if (options.compareSimd && options.checkDeterminism) {
+			std::fprintf(stderr, "--compare-simd  --check-determinism ͈ꏏɎgȂ\n");
+			return false;
+		}
+		return true;
+	}
+
+	double Percentile(std::vector<double>& samples, double p) {
+		if (samples.empty()) return 0;
+		const size_t index = std::min(samples.size() - 1, (size_t)(samples.size() * p));
+		std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+		return samples[index];
+	}
+
+	void SetupWorld(PhysicsWorld& world, const std::string& scenario, const Options& options) {
+		world.SetSubSteps(options.subSteps);
+		PhysicsWorld::SleepSettings sleep = world.GetSleepSettings();
+		sleep.enabled = (options.sleep != 0);
+		world.SetSleepSettings(sleep);
+		PhysicsWorld::SolverSettings solver = world.GetSolverSettings();
+		if (options.tolerance >= 0.0f) solver.tolerance = options.tolerance;
+		solver.budgetMs = options.budgetUs / 1000.0f;
+		world.SetSolverSettings(solver);
+		CreateScenario(scenario, world, options.config);
+	}
+
+	// Ŝ̕`p̓_ points ɕׂ (_Ȃol܂)
+	void ReadPoints(PhysicsWorld& world, std::vector<SnapshotPoint>& points) {
+		points.clear();
+		for (int b = 0; b < world.BodyCount(); b++) {
+			ISoftBody* body = world.Body(b);
+			const size_t first = points.size();
+			points.resize(first + body->RenderPointCount());
+			body->WriteRenderPoints(points.data() + first);
+		}
+	}
+
+	// `p̓_̈ʒu̍v (points ͍Ɨp)
+	double Checksum(PhysicsWorld& world, std::vector<SnapshotPoint>& points) {
+		ReadPoints(world, points);
+		double checksum = 0;
+		for (const SnapshotPoint& point : points) {
+			checksum += point.current.x + point.current.y;
+		}
+		return checksum;
+	}
+
+	void SetControl(PhysicsWorld& world, const BodyControl& control) {
+		for (int b = 0; b < world.BodyCount(); b++) {
+			world.Body(b)->SetControl(control);
+		}
+	}
+
+	Result Run(const std::string& scenario, const Options& options, const InputScript& script) {
+		PhysicsWorld world(options.threads);
+		SetupWorld(world, scenario, options);
+
+		Result result;
+		result.scenario = scenario;
+		result.bodies = world.BodyCount();
+		for (int b = 0; b < world.BodyCount(); b++) {
+			ISoftBody* body = world.Body(b);
+			const ParticleStore* particles = body->GetParticles();
+			// _Ȃol1̎_ƂĐ
+			result.nodes += particles ? particles->Size() : 1;
+			result.constraints += body->ConstraintCount();
+			// --iterations ȂƂAêۂɎgo (Ȃol 0)
+			result.iterations = std::max(result.iterations, body->IterationLimit());
+		}
+
+		// XebvƂ̎ (ns)
+		std::vector<double> samples;
+		samples.reserve(options.frames);
+		double totalNs = 0;
+		long long iterationSum = 0;
+		long long activeSum = 0;
+		const int totalFrames = options.warmup + options.frames;
+		for (int frame = 0; frame < totalFrames; frame++) {
+			SetControl(world, script.At(frame));
+
+			const auto begin = std::chrono::steady_clock::now();
+			world.Step(options.dt);
+			const auto end = std::chrono::steady_clock::now();
+			if (frame < options.warmup) continue;
+
+			const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+			samples.push_back(ns);
+			totalNs += ns;
+			const SolverStats& solve = world.LastSolveStats();
+			iterationSum += solve.iterations;
+			activeSum += world.ActiveBodyCount();
+			result.maxError = std::max(result.maxError, (double)solve.maxError);
+		}
+
+		const int steps = options.frames;
+		result.totalMs = totalNs / 1e6;
+		result.nsPerStep = steps > 0 ? totalNs / steps : 0;
+		result.nsPerNode = result.nodes > 0 ? result.nsPerStep / result.nodes : 0;
+		result.nsPerConstraint = result.constraints > 0 ? result.nsPerStep / result.constraints : 0;
+		result.p50 = Percentile(samples, 0.50);
+		result.p99 = Percentile(samples, 0.99);
+		result.sleeping = world.SleepingBodyCount();
+		result.avgIterations = activeSum > 0 ? (double)iterationSum / activeSum : 0;
+
+		// `p̓_̂ŁA_Ȃol܂܂
+		std::vector<SnapshotPoint> points;
+		result.checksum = Checksum(world, points);
+		return result;
+	}
+
+	// [J[12ƁA[J[ threads œ{i߁At[ StateHash  checksum ׂ
+	// 锻┽̑ł؂ʂ猈܂̂ŁÂ܂܎g (Ԃ̗\Z͎vŌ܂̂ŊO)
+	DeterminismResult CheckDeterminism(const std::string& scenario, const Options& options, const InputScript& script) {
+		Options check = options;
+		check.budgetUs = 0;
+		const int threads = (options.threads > 1) ? options.threads : 4;
+		PhysicsWorld first(1), repeat(1), parallel(threads);
+		SetupWorld(first, scenario, check);
+		SetupWorld(repeat, scenario, check);
+		SetupWorld(parallel, scenario, check);
+
+		DeterminismResult result;
+		result.scenario = scenario;
+		result.threads = threads;
+		std::vector<SnapshotPoint> points;
+		const int totalFrames = options.warmup + options.frames;
+		for (int frame = 0; frame < totalFrames; frame++) {
+			const BodyControl control = script.At(frame);
+			SetControl(first, control);
+			SetControl(repeat, control);
+			SetControl(parallel, control);
+			first.Step(options.dt);
+			repeat.Step(options.dt);
+			parallel.Step(options.dt);
+
+			result.hash = first.StateHash();
+			result.checksum = Checksum(first, points);
+			if (result.repeatMismatch < 0
+				&& (repeat.StateHash() != result.hash || Checksum(repeat, points) != result.checksum)) {
+				result.repeatMismatch = frame;
+			}
+			if (result.threadMismatch < 0
+				&& (parallel.StateHash() != result.hash || Checksum(parallel, points) != result.checksum)) {
+				result.threadMismatch = frame;
+			}
+		}
+		result.passed = (result.repeatMismatch < 0 && result.threadMismatch < 0);
+		return result;
+	}
+
+	double MaxDistance(const std::vector<SnapshotPoint>& a, const std::vector<SnapshotPoint>& b) {
+		double maxDist = 0;
+		for (size_t i = 0; i < a.size() && i < b.size(); i++) {
+			const double dx = a[i].current.x - b[i].current.x;
+			const double dy = a[i].current.y - b[i].current.y;
+			maxDist = std::max(maxDist, std::sqrt(dx * dx + dy * dy));
+		}
+		return maxDist;
+	}
+
+	// _2gɂč̋ 0.9 {ɏk߂鋗AXJ[ SIMD 1񂾂Ĕׂ
+	// g͏dȂȂ̂ŁAǂ̎_1̏C̍܂ (ďCƁAk񂾐ō{ɂL)
+	void CompareCorrection(const ParticleStore& particles, SimdLevel simd, CompareResult& result) {
+		const float weight = 0.5f;
+		const int count = particles.Size();
+		DistanceConstraints constraints;
+		constraints.SetOrder(ConstraintOrder::Coloured);
+		for (int i = 1; i < count; i += 2) {
+			const float dx = particles.x[i] - particles.x[i - 1];
+			const float dy = particles.y[i] - particles.y[i - 1];
+			constraints.Add(i - 1, i, std::sqrt(dx * dx + dy * dy) * 0.9f, weight, weight);
+		}
+		if (constraints.Size() == 0) return;
+
+		ParticleStore expected = particles, actual = particles;
+		SetSimdLevel(SimdLevel::Scalar);
+		constraints.Solve(expected);
+		SetSimdLevel(simd);
+		constraints.Solve(actual);
+		for (int i = 0; i < constraints.Size() * 2; i++) {
+			const float rest = constraints.rest[i / 2];
+			const float coords[] = { expected.x[i], expected.y[i] };
+			const float diffs[] = { actual.x[i] - expected.x[i], actual.y[i] - expected.y[i] };
+			for (int k = 0; k < 2; k++) {
+				//  rest * d * DISTANCE_SIMD_REST_ERROR ƁAʒû̂̊ۂ߂ 1ulp
+				const float magnitude = std::fabs(coords[k]);
+				const double ulp = std::nextafter(magnitude, INFINITY) - magnitude;
+				const double bound = rest * weight * DISTANCE_SIMD_REST_ERROR + ulp;
+				const double diff = std::fabs(diffs[k]);
+				result.correctionDiff = std::max(result.correctionDiff, diff);
+				result.correctionRatio = std::max(result.correctionRatio, diff / bound);
+			}
+		}
+	}
+
+	// XJ[̃J[lŐi߂[hƁASIMD Ői߂[ḧʒuׂ
+	// synced ͖Xebv̌ɃXJ[̎_ʂ̂ŁA1XebvɂȂB
+	// diverged ͎ʂɐiߑ̂ŁAڐG̗LȂǂꂽ̋Ô܂Ŋ܂ށB
+	// ǂڐGōL̂ŏ͂ȂA CompareCorrection 1̏C̍ōs
+	CompareResult CompareSimd(const std::string& scenario, const Options& options, const InputScript& script, SimdLevel simd) {
+		// 鎞⎞Ԃ̗\Zőł؂锽́A덷Ƃ͕ʂ̗RŌʂ𕪂̂ŎgȂ
+		Options compare = options;
+		compare.sleep = 0;
+		compare.budgetUs = 0;
+		PhysicsWorld scalar(options.threads), synced(options.threads), diverged(options.threads);
+		SetupWorld(scalar, scenario, compare);
+		SetupWorld(synced, scenario, compare);
+		SetupWorld(diverged, scenario, compare);
+
+		CompareResult result;
+		result.scenario = scenario;
+		result.simd = simd;
+		std::vector<SnapshotPoint> expected, actual;
+		const int totalFrames = options.warmup + options.frames;
+		for (int frame = 0; frame < totalFrames; frame++) {
+			const BodyControl control = script.At(frame);
+			SetControl(scalar, control);
+			SetControl(synced, control);
+			SetControl(diverged, control);
+			SetSimdLevel(SimdLevel::Scalar);
+			scalar.Step(options.dt);
+			SetSimdLevel(simd);
+			synced.Step(options.dt);
+			diverged.Step(options.dt);
+
+			ReadPoints(scalar, expected);
+			ReadPoints(synced, actual);
+			result.stepDiff = std::max(result.stepDiff, MaxDistance(expected, actual));
+			for (int b = 0; b < scalar.BodyCount(); b++) {
+				const ParticleStore* from = scalar.Body(b)->GetParticles();
+				if (!from) continue;
+				CompareCorrection(*from, simd, result);
+				// ̃XebvXJ[ƓԂn߂
+				*synced.Body(b)->GetParticles() = *from;
+			}
+		}
+		ReadPoints(diverged, actual);
+		result.finalDiff = MaxDistance(expected, actual);
+		result.passed = (result.correctionRatio <= 1.0);
+		return result;
+	}
+
+	void WriteCompareJson(FILE* fp, const Options& options, const std::vector<CompareResult>& results) {
+		std::fprintf(fp, "{\n");
+		std::fprintf(fp, "  \"frames\": %d,\n  \"substeps\": %d,\n", options.warmup + options.frames, options.subSteps);
+		std::fprintf(fp, "  \"results\": [\n");
+		for (size_t i = 0; i < results.size(); i++) {
+			const CompareResult& r = results[i];
+			std::fprintf(fp, "    {\"scenario\": \"%s\", \"simd\": \"%s\", \"correction_diff\": %.9g, \"correction_ratio\": %.4f, "
+				"\"step_diff\": %.9g, \"final_diff\": %.9g, \"passed\": %s}%s\n",
+				r.scenario.c_str(), SimdLevelName(r.simd), r.correctionDiff, r.correctionRatio, r.stepDiff, r.finalDiff, r.passed ? "true" : "false",
+				(i + 1 < results.size()) ? "," : "");
+		}
+		std::fprintf(fp, "  ]\n}\n");
+	}
+
+	void WriteCompareCsv(FILE* fp, const std::vector<CompareResult>& results) {
+		std::fprintf(fp, "scenario,simd,correction_diff,correction_ratio,step_diff,final_diff,passed\n");
+		for (const CompareResult& r : results) {
+			std::fprintf(fp, "%s,%s,%.9g,%.4f,%.9g,%.9g,%d\n", r.scenario.c_str(), SimdLevelName(r.simd),
+				r.correctionDiff, r.correctionRatio, r.stepDiff, r.finalDiff, r.passed ? 1 : 0);
+		}
+	}
+
+	void WriteDeterminismJson(FILE* fp, const Options& options, const std::vector<DeterminismResult>& results) {
+		std::fprintf(fp, "{\n");
+		std::fprintf(fp, "  \"frames\": %d,\n  \"substeps\": %d,\n", options.warmup + options.frames, options.subSteps);
+		std::fprintf(fp, "  \"results\": [\n");
+		for (size_t i = 0; i < results.size(); i++) {
+			const DeterminismResult& r = results[i];
+			std::fprintf(fp, "    {\"scenario\": \"%s\", \"threads\": %d, \"hash\": \"%08x\", \"checksum\": %.6f, "
+				"\"repeat_mismatch\": %d, \"thread_mismatch\": %d, \"passed\": %s}%s\n",
+				r.scenario.c_str(), r.threads, r.hash, r.checksum, r.repeatMismatch, r.threadMismatch, r.passed ? "true" : "false",
+				(i + 1 < results.size()) ? "," : "");
+		}
+		std::fprintf(fp, "  ]\n}\n");
+	}
+
+	void WriteDeterminismCsv(FILE* fp, const std::vector<DeterminismResult>& results) {
+		std::fprintf(fp, "scenario,threads,hash,checksum,repeat_mismatch,thread_mismatch,passed\n");
+		for (const DeterminismResult& r : results) {
+			std::fprintf(fp, "%s,%d,%08x,%.6f,%d,%d,%d\n", r.scenario.c_str(), r.threads, r.hash, r.checksum,
+				r.repeatMismatch, r.threadMismatch, r.passed ? 1 : 0);
+		}
+	}
+
+	void WriteJson(FILE* fp, const Options& options, const std::vector<Result>& results) {
+		std::fprintf(fp, "{\n");
+		std::fprintf(fp, "  \"frames\": %d,\n  \"warmup\": %d,\n  \"substeps\": %d,\n  \"dt\": %.9g,\n",
+			options.frames, options.warmup, options.subSteps, options.dt);
+		std::fprintf(fp, "  \"script\": \"%s\",\n", options.script.c_str());
+		std::fprintf(fp, "  \"results\": [\n");
+		for (size_t i = 0; i < results.size(); i++) {
+			const Result& r = results[i];
+			std::fprintf(fp,
+				"    {\"scenario\": \"%s\", \"bodies\": %d, \"nodes\": %d, \"constraints\": %d, \"iterations\": %d, "
+				"\"total_ms\": %.3f, \"ns_per_step\": %.1f, \"ns_per_node\": %.2f, \"ns_per_constraint\": %.2f, "
+				"\"p50_ns\": %.1f, \"p99_ns\": %.1f, \"sleeping\": %d, \"avg_iterations\": %.2f, \"max_error\": %.4f, \"checksum\": %.6f}%s\n",
+				r.scenario.c_str(), r.bodies, r.nodes, r.constraints, r.iterations,
+				r.totalMs, r.nsPerStep, r.nsPerNode, r.nsPerConstraint, r.p50, r.p99, r.sleeping,
+				r.avgIterations, r.maxError, r.checksum,
+				(i + 1 < results.size()) ? "," : "");
+		}
+		std::fprintf(fp, "  ]\n}\n");
+	}
+
+	void WriteCsv(FILE* fp, const std::vector<Result>& results) {
+		std::fprintf(fp, "scenario,bodies,nodes,constraints,iterations,total_ms,ns_per_step,ns_per_node,ns_per_constraint,p50_ns,p99_ns,sleeping,avg_iterations,max_error,checksum\n");
+		for (const Result& r : results) {
+			std::fprintf(fp, "%s,%d,%d,%d,%d,%.3f,%.1f,%.2f,%.2f,%.1f,%.1f,%d,%.2f,%.4f,%.6f\n",
+				r.scenario.c_str(), r.bodies, r.nodes, r.constraints, r.iterations,
+				r.totalMs, r.nsPerStep, r.nsPerNode, r.nsPerConstraint, r.p50, r.p99, r.sleeping,
+				r.avgIterations, r.maxError, r.checksum);
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!ParseOptions(argc, argv, options)) {
+		PrintUsage();
+		return 1;
+	}
+
+	InputScript script;
+	std::string error;
+	if (!script.Parse(options.script, error)) {
+		std::fprintf(stderr, "{ǂ߂Ȃ: %s\n", error.c_str());
+		return 1;
+	}
+
+	std::vector<std::string> scenarios;
+	if (options.scenario == "all") {
+		for (const char* const* name = ScenarioNames(); *name; name++) scenarios.push_back(*name);
+	}
+	else {
+		bool known = false;
+		for (const char* const* name = ScenarioNames(); *name; name++) known |= (options.scenario == *name);
+		if (!known) {
+			std::fprintf(stderr, "mȂViI %s\n", options.scenario.c_str());
+			PrintUsage();
+			return 1;
+		}
+		scenarios.push_back(options.scenario);
+	}
+
+	// XJ[Ɣׂ閽߃Zbg (܂ĂȂ̂ŁACPU ŎgԍL̂܂)
+	const SimdLevel widest = GetSimdLevel();
+	std::vector<Result> results;
+	std::vector<CompareResult> compared;
+	std::vector<DeterminismResult> checked;
+	bool passed = true;
+	for (const std::string& scenario : scenarios) {
+		if (options.compareSimd) {
+			for (int level = (int)SimdLevel::SSE2; level <= (int)widest; level++) {
+				compared.push_back(CompareSimd(scenario, options, script, (SimdLevel)level));
+				if (!compared.back().passed) {
+					std::fprintf(stderr, "%s: XJ[ %s 1̏C̍ ConstraintKernels.h ̏𒴂\n",
+						scenario.c_str(), SimdLevelName((SimdLevel)level));
+					passed = false;
+				}
+			}
+		}
+		else if (options.checkDeterminism) {
+			checked.push_back(CheckDeterminism(scenario, options, script));
+			const DeterminismResult& r = checked.back();
+			if (r.repeatMismatch >= 0) {
+				std::fprintf(stderr, "%s: 2ڂt[ %d ŐH\n", scenario.c_str(), r.repeatMismatch);
+				passed = false;
+			}
+			if (r.threadMismatch >= 0) {
+				std::fprintf(stderr, "%s: [J[ %d ł̓t[ %d ŐH\n", scenario.c_str(), r.threads, r.threadMismatch);
+				passed = false;
+			}
+		}
+		else {
+			results.push_back(Run(scenario, options, script));
+		}
+	}
+
+	FILE* fp = stdout;
+	if (!options.out.empty()) {
+#ifdef _MSC_VER
+		if (fopen_s(&fp, options.out.c_str(), "w") != 0) fp = nullptr;
+#else
+		fp = std::fopen(options.out.c_str(), "w");
+#endif
+		if (!fp) {
+			std::fprintf(stderr, "%s JȂ\n", options.out.c_str());
+			return 1;
+		}
+	}
+	if (options.compareSimd) {
+		if (options.format == "csv") WriteCompareCsv(fp, compared);
+		else WriteCompareJson(fp, options, compared);
+	}
+	else if (options.checkDeterminism) {
+		if (options.format == "csv") WriteDeterminismCsv(fp, checked);
+		else WriteDeterminismJson(fp, options, checked);
+	}
+	else if (options.format == "csv") WriteCsv(fp, results);
+	else WriteJson(fp, options, results);
+	if (fp != stdout) std::fclose(fp);
+	return passed ? 0 : 1;
+}
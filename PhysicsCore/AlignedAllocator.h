@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+// SIMD ł܂Ƃ߂ēǂ߂悤ɐ擪낦ĊmۂAP[^
+// std::vector<float, AlignedAllocator<float>> ̂悤Ɏg
+template<class T, std::size_t Alignment = 32>
+struct AlignedAllocator {
+	using value_type = T;
+
+	template<class U>
+	struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+	AlignedAllocator() noexcept {}
+	template<class U>
+	AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+	T* allocate(std::size_t n) {
+		return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+	}
+	void deallocate(T* p, std::size_t) noexcept {
+		::operator delete(p, std::align_val_t(Alignment));
+	}
+};
+
+template<class T, class U, std::size_t A>
+bool operator==(const AlignedAllocator<T, A>&, const AlignedAllocator<U, A>&) { return true; }
+template<class T, class U, std::size_t A>
+bool operator!=(const AlignedAllocator<T, A>&, const AlignedAllocator<U, A>&) { return false; }
@@ -0,0 +1,12 @@
+#pragma once
+
+// {fB𑀍삷邽߂̓
+// DxLib̃L[͂̓Q[ł̍\̂ɕϊĂn
+struct BodyControl {
+	bool left = false;   // A L[
+	bool right = false;  // D L[
+	bool up = false;     // W L[
+	bool down = false;   // S L[
+
+	bool Any() const { return left || right || up || down; }
+};
@@ -0,0 +1,188 @@
+#include "ConstraintKernels.h"
+#include "SimdSupport.h"
+#include <cmath>
+
+#if PHYSICS_HAS_X86_SIMD
+#include <emmintrin.h>
+#endif
+
+void SolveDistanceScalar(const DistanceKernelArgs& args, int c) {
+	const int a = args.i0[c];
+	const int b = args.i1[c];
+	float diffX = args.x[a] - args.x[b];
+	float diffY = args.y[a] - args.y[b];
+	float distSq = diffX * diffX + diffY * diffY;
+	float currentDist = std::sqrt(distSq);
+	if (args.error) AddDistanceError(args, c, currentDist);
+	if (distSq <= 0.0f) return;
+
+	float correctFactor = (currentDist - args.rest[c]) / currentDist;
+	float correctX = diffX * correctFactor;
+	float correctY = diffY * correctFactor;
+
+	args.x[a] -= correctX * args.w0[c];
+	args.y[a] -= correctY * args.w0[c];
+	args.x[b] += correctX * args.w1[c];
+	args.y[b] += correctY * args.w1[c];
+}
+
+void SolveDistanceXPBDScalar(const DistanceKernelArgs& args, int c) {
+	const int a = args.i0[c];
+	const int b = args.i1[c];
+	float diffX = args.x[a] - args.x[b];
+	float diffY = args.y[a] - args.y[b];
+	float distSq = diffX * diffX + diffY * diffY;
+	float currentDist = std::sqrt(distSq);
+	if (args.error) AddDistanceError(args, c, currentDist);
+	if (distSq <= 0.0f) return;
+
+	float alpha = args.compliance[c] * args.invDtSq;
+	float denom = args.w0[c] + args.w1[c] + alpha;
+	if (denom <= 0.0f) return;
+
+	float C = currentDist - args.rest[c];
+	float deltaLambda = (-C - alpha * args.lambda[c]) / denom;
+	args.lambda[c] += deltaLambda;
+
+	// n * dLambda = diff * (dLambda / D)
+	float s = deltaLambda / currentDist;
+	float moveX = diffX * s;
+	float moveY = diffY * s;
+	args.x[a] += moveX * args.w0[c];
+	args.y[a] += moveY * args.w0[c];
+	args.x[b] -= moveX * args.w1[c];
+	args.y[b] -= moveY * args.w1[c];
+}
+
+#if PHYSICS_HAS_X86_SIMD
+namespace {
+	// |D - rest| Aǂ̓_Ȃ 0 ɂ error ɑ
+	void AddErrorsSSE2(const DistanceKernelArgs& args, int c, __m128 dist) {
+		const __m128 zero = _mm_setzero_ps();
+		__m128 w0 = _mm_loadu_ps(args.w0 + c);
+		__m128 w1 = _mm_loadu_ps(args.w1 + c);
+		__m128 counted = _mm_or_ps(_mm_cmpneq_ps(w0, zero), _mm_cmpneq_ps(w1, zero));
+		__m128 diff = _mm_sub_ps(dist, _mm_loadu_ps(args.rest + c));
+		__m128 absDiff = _mm_andnot_ps(_mm_set1_ps(-0.0f), diff);
+
+		alignas(16) float absError[4];
+		_mm_store_ps(absError, _mm_and_ps(absDiff, counted));
+		int mask = _mm_movemask_ps(counted);
+		int countedLanes = 0;
+		for (; mask != 0; mask &= mask - 1) ++countedLanes;
+		AddDistanceErrors(*args.error, absError, 4, countedLanes);
+	}
+}
+
+void SolveDistanceSSE2x4(const DistanceKernelArgs& args, int c) {
+	const int* i0 = args.i0 + c;
+	const int* i1 = args.i1 + c;
+	const float* x = args.x;
+	const float* y = args.y;
+
+	// SSE2 ɂ gather ̂1ǂ
+	__m128 ax = _mm_setr_ps(x[i0[0]], x[i0[1]], x[i0[2]], x[i0[3]]);
+	__m128 ay = _mm_setr_ps(y[i0[0]], y[i0[1]], y[i0[2]], y[i0[3]]);
+	__m128 bx = _mm_setr_ps(x[i1[0]], x[i1[1]], x[i1[2]], x[i1[3]]);
+	__m128 by = _mm_setr_ps(y[i1[0]], y[i1[1]], y[i1[2]], y[i1[3]]);
+
+	__m128 diffX = _mm_sub_ps(ax, bx);
+	__m128 diffY = _mm_sub_ps(ay, by);
+	__m128 distSq = _mm_add_ps(_mm_mul_ps(diffX, diffX), _mm_mul_ps(diffY, diffY));
+
+	// r = 1/D (rsqrt ̋ߎl Newton @1␳: r = r * (1.5 - 0.5 * D^2 * r^2))
+	__m128 r = _mm_rsqrt_ps(distSq);
+	__m128 halfDistSq = _mm_mul_ps(_mm_set1_ps(0.5f), distSq);
+	r = _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfDistSq, _mm_mul_ps(r, r))));
+	__m128 positive = _mm_cmpgt_ps(distSq, _mm_setzero_ps());
+
+	// D = D^2 / D (D == 0 ̃[ 0 * inf ɂȂȂ悤 0 ɂ)
+	if (args.error) AddErrorsSSE2(args, c, _mm_and_ps(_mm_mul_ps(distSq, r), positive));
+
+	// (D - L) / D = 1 - L / DBD == 0 ̃[͏CȂ
+	__m128 factor = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_loadu_ps(args.rest + c), r));
+	factor = _mm_and_ps(factor, positive);
+
+	__m128 correctX = _mm_mul_ps(diffX, factor);
+	__m128 correctY = _mm_mul_ps(diffY, factor);
+	__m128 w0 = _mm_loadu_ps(args.w0 + c);
+	__m128 w1 = _mm_loadu_ps(args.w1 + c);
+
+	alignas(16) float dx0[4], dy0[4], dx1[4], dy1[4];
+	_mm_store_ps(dx0, _mm_mul_ps(correctX, w0));
+	_mm_store_ps(dy0, _mm_mul_ps(correctY, w0));
+	_mm_store_ps(dx1, _mm_mul_ps(correctX, w1));
+	_mm_store_ps(dy1, _mm_mul_ps(correctY, w1));
+
+	// _2̐񂪓Ƃ͂Ȃ̂ŁAԂɑ߂΂悢
+	for (int k = 0; k < 4; ++k) {
+		args.x[i0[k]] -= dx0[k];
+		args.y[i0[k]] -= dy0[k];
+		args.x[i1[k]] += dx1[k];
+		args.y[i1[k]] += dy1[k];
+	}
+}
+
+void SolveDistanceXPBDSSE2x4(const DistanceKernelArgs& args, int c) {
+	const int* i0 = args.i0 + c;
+	const int* i1 = args.i1 + c;
+	const float* x = args.x;
+	const float* y = args.y;
+
+	__m128 ax = _mm_setr_ps(x[i0[0]], x[i0[1]], x[i0[2]], x[i0[3]]);
+	__m128 ay = _mm_setr_ps(y[i0[0]], y[i0[1]], y[i0[2]], y[i0[3]]);
+	__m128 bx = _mm_setr_ps(x[i1[0]], x[i1[1]], x[i1[2]], x[i1[3]]);
+	__m128 by = _mm_setr_ps(y[i1[0]], y[i1[1]], y[i1[2]], y[i1[3]]);
+
+	__m128 diffX = _mm_sub_ps(ax, bx);
+	__m128 diffY = _mm_sub_ps(ay, by);
+	__m128 distSq = _mm_add_ps(_mm_mul_ps(diffX, diffX), _mm_mul_ps(diffY, diffY));
+
+	__m128 r = _mm_rsqrt_ps(distSq);
+	__m128 halfDistSq = _mm_mul_ps(_mm_set1_ps(0.5f), distSq);
+	r = _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfDistSq, _mm_mul_ps(r, r))));
+	__m128 dist = _mm_and_ps(_mm_mul_ps(distSq, r), _mm_cmpgt_ps(distSq, _mm_setzero_ps()));
+
+	if (args.error) AddErrorsSSE2(args, c, dist);
+
+	__m128 w0 = _mm_loadu_ps(args.w0 + c);
+	__m128 w1 = _mm_loadu_ps(args.w1 + c);
+	__m128 lambda = _mm_loadu_ps(args.lambda + c);
+	__m128 alpha = _mm_mul_ps(_mm_loadu_ps(args.compliance + c), _mm_set1_ps(args.invDtSq));
+	__m128 denom = _mm_add_ps(_mm_add_ps(w0, w1), alpha);
+
+	// D == 0 ╪ꂪ 0 ̃[͏CȂ (ZOɕ 1 ɂĂ)
+	__m128 valid = _mm_and_ps(_mm_cmpgt_ps(distSq, _mm_setzero_ps()), _mm_cmpgt_ps(denom, _mm_setzero_ps()));
+	denom = _mm_or_ps(_mm_and_ps(valid, denom), _mm_andnot_ps(valid, _mm_set1_ps(1.0f)));
+
+	__m128 C = _mm_sub_ps(dist, _mm_loadu_ps(args.rest + c));
+	__m128 numer = _mm_sub_ps(_mm_sub_ps(_mm_setzero_ps(), C), _mm_mul_ps(alpha, lambda));
+	__m128 deltaLambda = _mm_and_ps(valid, _mm_div_ps(numer, denom));
+	_mm_storeu_ps(args.lambda + c, _mm_add_ps(lambda, deltaLambda));
+
+	__m128 s = _mm_and_ps(valid, _mm_mul_ps(deltaLambda, r));
+	__m128 moveX = _mm_mul_ps(diffX, s);
+	__m128 moveY = _mm_mul_ps(diffY, s);
+
+	alignas(16) float dx0[4], dy0[4], dx1[4], dy1[4];
+	_mm_store_ps(dx0, _mm_mul_ps(moveX, w0));
+	_mm_store_ps(dy0, _mm_mul_ps(moveY, w0));
+	_mm_store_ps(dx1, _mm_mul_ps(moveX, w1));
+	_mm_store_ps(dy1, _mm_mul_ps(moveY, w1));
+
+	for (int k = 0; k < 4; ++k) {
+		args.x[i0[k]] += dx0[k];
+		args.y[i0[k]] += dy0[k];
+		args.x[i1[k]] -= dx1[k];
+		args.y[i1[k]] -= dy1[k];
+	}
+}
+#else
+void SolveDistanceSSE2x4(const DistanceKernelArgs& args, int c) {
+	for (int k = 0; k < 4; ++k) SolveDistanceScalar(args, c + k);
+}
+
+void SolveDistanceXPBDSSE2x4(const DistanceKernelArgs& args, int c) {
+	for (int k = 0; k < 4; ++k) SolveDistanceXPBDScalar(args, c + k);
+}
+#endif
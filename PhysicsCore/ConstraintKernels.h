@@ -0,0 +1,74 @@
+#pragma once
+#include "SolverConvergence.h"
+
+// J[l (DistanceConstraints 炾g)
+//
+// ǂ̃J[l c ɂ
+//   d = p[i0] - p[i1], D = |d|, f = (D - rest) / D
+//   p[i0] -= d * f * w0,  p[i1] += d * f * w1
+// vZBD == 0 ͕̐܂Ȃ̂ŉȂB
+//
+// SIMD ł f = 1 - rest * rsqrt(D^2) ƂArsqrt ̋ߎl (12bit) 
+// Newton @ 1ŐxグĂBXJ[ (sqrt ƏZ) Ƃ̍́A1̏C
+// |rest| * d * DISTANCE_SIMD_REST_ERROR (2.5e-7) ƁAʒû̂̊ۂ 1ulp ȓɎ܂B
+// ̂͂1񕪂ŁAXebvd˂ʒu̍ɂ͏ȂB
+// k݂͑ȌC̍{ɂLAڐG┽̑ł؂̔肪x
+// ̌̋O͕ʕɂȂ (64m[h̃Oł 600 Xebvɐ px 琔\ px )B
+// XJ[ƓʂvƂ (vCȂ)  SetSimdLevel(SimdLevel::Scalar) ɂ邱ƁB
+// 1񕪂̏ PhysicsBench --compare-simd 1 Ŋm߂B
+//
+// XPBD ł w0, w1 ʂ̋tƂĈA񂲂Ƃ̏_炩 (compliance) 
+// ݐσOW搔 lambda g:
+//   C = D - rest, a = compliance / dt^2
+//   dLambda = (-C - a * lambda) / (w0 + w1 + a), lambda += dLambda
+//   p[i0] += n * dLambda * w0,  p[i1] -= n * dLambda * w1   (n = d / D)
+//
+// error  nullptr łȂ΁AC̑O D - rest  error ɑ (ł؂邩̔fɎg)B
+// D ͂ǂ݂̂߂Ă̂ŁAʂɑ蒼Bǂ̓_Ȃ͐Ȃ
+struct DistanceKernelArgs {
+	float* x;
+	float* y;
+	const int* i0;
+	const int* i1;
+	const float* rest;
+	const float* w0;
+	const float* w1;
+	// ȉ XPBD ̂Ƃg
+	float* lambda;
+	const float* compliance;
+	float invDtSq;
+	// ᔽWvȂȂ nullptr
+	ConstraintError* error;
+};
+
+//  c ̍̋ dist  rest ̍ args.error ɑ
+inline void AddDistanceError(const DistanceKernelArgs& args, int c, float dist) {
+	if (args.w0[c] == 0.0f && args.w1[c] == 0.0f) return;
+	args.error->Add(dist - args.rest[c]);
+}
+
+// SIMD ł1ubN (n )  |D - rest| ܂Ƃ߂đ
+// Ȃ absError  0 ɂĂA counted œn
+inline void AddDistanceErrors(ConstraintError& error, const float* absError, int n, int counted) {
+	float max = error.max;
+	float sumSq = 0.0f;
+	for (int k = 0; k < n; ++k) {
+		if (absError[k] > max) max = absError[k];
+		sumSq += absError[k] * absError[k];
+	}
+	error.max = max;
+	error.sumSq += sumSq;
+	error.count += counted;
+}
+
+//  c 1
+void SolveDistanceScalar(const DistanceKernelArgs& args, int c);
+//  c ` c+3  SSE2 ł܂Ƃ߂ĉ (O̐񂪓_̐񂪎gȂ)
+void SolveDistanceSSE2x4(const DistanceKernelArgs& args, int c);
+//  c ` c+7  AVX2 ł܂Ƃ߂ĉ ()
+void SolveDistanceAVX2x8(const DistanceKernelArgs& args, int c);
+
+// XPBD  (̕ו̏ PBD łƓ)
+void SolveDistanceXPBDScalar(const DistanceKernelArgs& args, int c);
+void SolveDistanceXPBDSSE2x4(const DistanceKernelArgs& args, int c);
+void SolveDistanceXPBDAVX2x8(const DistanceKernelArgs& args, int c);
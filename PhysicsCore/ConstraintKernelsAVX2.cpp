@@ -0,0 +1,138 @@
+// ̃t@C AVX2 LɂăRpC (GCC / Clang  -mavx2)
+// Ăяo GetSimdLevel()  AVX2 ԂƂ
+#include "ConstraintKernels.h"
+#include "SimdSupport.h"
+
+#if PHYSICS_HAS_X86_SIMD && (defined(_MSC_VER) || defined(__AVX2__))
+#include <immintrin.h>
+
+namespace {
+	// |D - rest| Aǂ̓_Ȃ 0 ɂ error ɑ
+	void AddErrorsAVX2(const DistanceKernelArgs& args, int c, __m256 dist) {
+		const __m256 zero = _mm256_setzero_ps();
+		__m256 w0 = _mm256_loadu_ps(args.w0 + c);
+		__m256 w1 = _mm256_loadu_ps(args.w1 + c);
+		__m256 counted = _mm256_or_ps(_mm256_cmp_ps(w0, zero, _CMP_NEQ_UQ), _mm256_cmp_ps(w1, zero, _CMP_NEQ_UQ));
+		__m256 diff = _mm256_sub_ps(dist, _mm256_loadu_ps(args.rest + c));
+		__m256 absDiff = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), diff);
+
+		alignas(32) float absError[8];
+		_mm256_store_ps(absError, _mm256_and_ps(absDiff, counted));
+		int mask = _mm256_movemask_ps(counted);
+		int countedLanes = 0;
+		for (; mask != 0; mask &= mask - 1) ++countedLanes;
+		AddDistanceErrors(*args.error, absError, 8, countedLanes);
+	}
+}
+
+void SolveDistanceAVX2x8(const DistanceKernelArgs& args, int c) {
+	__m256i i0 = _mm256_loadu_si256((const __m256i*)(args.i0 + c));
+	__m256i i1 = _mm256_loadu_si256((const __m256i*)(args.i1 + c));
+
+	__m256 ax = _mm256_i32gather_ps(args.x, i0, 4);
+	__m256 ay = _mm256_i32gather_ps(args.y, i0, 4);
+	__m256 bx = _mm256_i32gather_ps(args.x, i1, 4);
+	__m256 by = _mm256_i32gather_ps(args.y, i1, 4);
+
+	__m256 diffX = _mm256_sub_ps(ax, bx);
+	__m256 diffY = _mm256_sub_ps(ay, by);
+	__m256 distSq = _mm256_add_ps(_mm256_mul_ps(diffX, diffX), _mm256_mul_ps(diffY, diffY));
+
+	// r = 1/D (SSE2 łƓ Newton ␳BFMA ͎g킸 SSE2 łƊۂ߂낦)
+	__m256 r = _mm256_rsqrt_ps(distSq);
+	__m256 halfDistSq = _mm256_mul_ps(_mm256_set1_ps(0.5f), distSq);
+	r = _mm256_mul_ps(r, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfDistSq, _mm256_mul_ps(r, r))));
+	__m256 positive = _mm256_cmp_ps(distSq, _mm256_setzero_ps(), _CMP_GT_OQ);
+
+	if (args.error) AddErrorsAVX2(args, c, _mm256_and_ps(_mm256_mul_ps(distSq, r), positive));
+
+	__m256 factor = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_loadu_ps(args.rest + c), r));
+	factor = _mm256_and_ps(factor, positive);
+
+	__m256 correctX = _mm256_mul_ps(diffX, factor);
+	__m256 correctY = _mm256_mul_ps(diffY, factor);
+	__m256 w0 = _mm256_loadu_ps(args.w0 + c);
+	__m256 w1 = _mm256_loadu_ps(args.w1 + c);
+
+	alignas(32) float dx0[8], dy0[8], dx1[8], dy1[8];
+	_mm256_store_ps(dx0, _mm256_mul_ps(correctX, w0));
+	_mm256_store_ps(dy0, _mm256_mul_ps(correctY, w0));
+	_mm256_store_ps(dx1, _mm256_mul_ps(correctX, w1));
+	_mm256_store_ps(dy1, _mm256_mul_ps(correctY, w1));
+
+	// AVX2 ɂ scatter ̂1߂
+	const int* a = args.i0 + c;
+	const int* b = args.i1 + c;
+	for (int k = 0; k < 8; ++k) {
+		args.x[a[k]] -= dx0[k];
+		args.y[a[k]] -= dy0[k];
+		args.x[b[k]] += dx1[k];
+		args.y[b[k]] += dy1[k];
+	}
+}
+
+void SolveDistanceXPBDAVX2x8(const DistanceKernelArgs& args, int c) {
+	__m256i i0 = _mm256_loadu_si256((const __m256i*)(args.i0 + c));
+	__m256i i1 = _mm256_loadu_si256((const __m256i*)(args.i1 + c));
+
+	__m256 ax = _mm256_i32gather_ps(args.x, i0, 4);
+	__m256 ay = _mm256_i32gather_ps(args.y, i0, 4);
+	__m256 bx = _mm256_i32gather_ps(args.x, i1, 4);
+	__m256 by = _mm256_i32gather_ps(args.y, i1, 4);
+
+	__m256 diffX = _mm256_sub_ps(ax, bx);
+	__m256 diffY = _mm256_sub_ps(ay, by);
+	__m256 distSq = _mm256_add_ps(_mm256_mul_ps(diffX, diffX), _mm256_mul_ps(diffY, diffY));
+
+	__m256 r = _mm256_rsqrt_ps(distSq);
+	__m256 halfDistSq = _mm256_mul_ps(_mm256_set1_ps(0.5f), distSq);
+	r = _mm256_mul_ps(r, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfDistSq, _mm256_mul_ps(r, r))));
+	__m256 dist = _mm256_and_ps(_mm256_mul_ps(distSq, r), _mm256_cmp_ps(distSq, _mm256_setzero_ps(), _CMP_GT_OQ));
+
+	if (args.error) AddErrorsAVX2(args, c, dist);
+
+	__m256 w0 = _mm256_loadu_ps(args.w0 + c);
+	__m256 w1 = _mm256_loadu_ps(args.w1 + c);
+	__m256 lambda = _mm256_loadu_ps(args.lambda + c);
+	__m256 alpha = _mm256_mul_ps(_mm256_loadu_ps(args.compliance + c), _mm256_set1_ps(args.invDtSq));
+	__m256 denom = _mm256_add_ps(_mm256_add_ps(w0, w1), alpha);
+
+	__m256 valid = _mm256_and_ps(_mm256_cmp_ps(distSq, _mm256_setzero_ps(), _CMP_GT_OQ),
+		_mm256_cmp_ps(denom, _mm256_setzero_ps(), _CMP_GT_OQ));
+	denom = _mm256_blendv_ps(_mm256_set1_ps(1.0f), denom, valid);
+
+	__m256 C = _mm256_sub_ps(dist, _mm256_loadu_ps(args.rest + c));
+	__m256 numer = _mm256_sub_ps(_mm256_sub_ps(_mm256_setzero_ps(), C), _mm256_mul_ps(alpha, lambda));
+	__m256 deltaLambda = _mm256_and_ps(valid, _mm256_div_ps(numer, denom));
+	_mm256_storeu_ps(args.lambda + c, _mm256_add_ps(lambda, deltaLambda));
+
+	__m256 s = _mm256_and_ps(valid, _mm256_mul_ps(deltaLambda, r));
+	__m256 moveX = _mm256_mul_ps(diffX, s);
+	__m256 moveY = _mm256_mul_ps(diffY, s);
+
+	alignas(32) float dx0[8], dy0[8], dx1[8], dy1[8];
+	_mm256_store_ps(dx0, _mm256_mul_ps(moveX, w0));
+	_mm256_store_ps(dy0, _mm256_mul_ps(moveY, w0));
+	_mm256_store_ps(dx1, _mm256_mul_ps(moveX, w1));
+	_mm256_store_ps(dy1, _mm256_mul_ps(moveY, w1));
+
+	const int* a = args.i0 + c;
+	const int* b = args.i1 + c;
+	for (int k = 0; k < 8; ++k) {
+		args.x[a[k]] += dx0[k];
+		args.y[a[k]] += dy0[k];
+		args.x[b[k]] -= dx1[k];
+		args.y[b[k]] -= dy1[k];
+	}
+}
+#else
+void SolveDistanceAVX2x8(const DistanceKernelArgs& args, int c) {
+	SolveDistanceSSE2x4(args, c);
+	SolveDistanceSSE2x4(args, c + 4);
+}
+
+void SolveDistanceXPBDAVX2x8(const DistanceKernelArgs& args, int c) {
+	SolveDistanceXPBDSSE2x4(args, c);
+	SolveDistanceXPBDSSE2x4(args, c + 4);
+}
+#endif
@@ -0,0 +1,261 @@
+#include "ContactSolver.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	bool SameShape(const CollisionShape& a, const CollisionShape& b) {
+		return a.nodeCount == b.nodeCount && a.closed == b.closed && a.radius == b.radius;
+	}
+
+	// v  order ̏ɕבւ (v[k]   v[order[k]])Bscratch  v Ɠ̍Ɨp
+	template<class V, class T>
+	void Permute(V& v, const std::vector<int>& order, T* scratch) {
+		const size_t count = v.size();
+		for (size_t k = 0; k < count; ++k) {
+			scratch[k] = v[order[k]];
+		}
+		std::copy(scratch, scratch + count, v.begin());
+	}
+
+	// _ i, j  minDist ߂΁AdȂʂ̔ŕĉB true
+	inline bool SeparatePair(float* x, float* y, const float* invMass, int i, int j, float minDist) {
+		const float dx = x[j] - x[i];
+		const float dy = y[j] - y[i];
+		const float distSq = dx * dx + dy * dy;
+		// ̂قƂǂ͐ڐGȂ̂ŁA͂܂Ƃ߂1ŕ򂷂 (\Oɂ)
+		const bool touching = (distSq < minDist * minDist) & (distSq > 0.0f);
+		if (!touching) return false;
+		const float wSum = invMass[i] + invMass[j];
+		if (wSum == 0.0f) return false;
+
+		const float dist = std::sqrt(distSq);
+		const float s = (minDist - dist) / (dist * wSum);
+		x[i] -= dx * s * invMass[i];
+		y[i] -= dy * s * invMass[i];
+		x[j] += dx * s * invMass[j];
+		y[j] += dy * s * invMass[j];
+		return true;
+	}
+
+	// _ p  a-b  minDist ߂ΉB true
+	// ŋߓ_[_̏ (t  0 ȉ 1 ȏ) Ȃ玿_m̐ڐGɔC ([_̂̂ŏ)
+	inline bool SeparateFromEdge(float* x, float* y, const float* invMass, int p, int a, int b, float minDist) {
+		const float ax = x[a], ay = y[a];
+		const float ex = x[b] - ax, ey = y[b] - ay;
+		const float lenSq = ex * ex + ey * ey;
+		if (lenSq == 0.0f) return false;
+		const float px = x[p], py = y[p];
+		// ӏňԋ߂_ (t  a  b ̊)
+		const float t = ((px - ax) * ex + (py - ay) * ey) / lenSq;
+		const float dx = px - (ax + ex * t);
+		const float dy = py - (ay + ey * t);
+		const float distSq = dx * dx + dy * dy;
+		const bool touching = (t > 0.0f) & (t < 1.0f) & (distSq < minDist * minDist) & (distSq > 0.0f);
+		if (!touching) return false;
+
+		// ӑ̏d݂͍ŋߓ_̈ʒuŗ[ɕ
+		const float wa = invMass[a] * (1.0f - t);
+		const float wb = invMass[b] * t;
+		const float wSum = invMass[p] + wa * (1.0f - t) + wb * t;
+		if (wSum == 0.0f) return false;
+
+		const float dist = std::sqrt(distSq);
+		const float s = (minDist - dist) / (dist * wSum);
+		x[p] = px + dx * s * invMass[p];
+		y[p] = py + dy * s * invMass[p];
+		x[a] -= dx * s * wa;
+		y[a] -= dy * s * wa;
+		x[b] -= dx * s * wb;
+		y[b] -= dy * s * wb;
+		return true;
+	}
+}
+
+void ContactSolver::Gather(ISoftBody* const* bodies, int bodyCount) {
+	bool sameLayout = ((int)stores.size() == bodyCount);
+	stores.resize(bodyCount);
+	shapes.resize(bodyCount);
+	for (int b = 0; b < bodyCount; ++b) {
+		ParticleStore* store = bodies[b]->GetParticles();
+		CollisionShape shape = bodies[b]->GetCollisionShape();
+		if (store == nullptr || shape.radius <= 0.0f) shape.nodeCount = 0;
+		else if (shape.nodeCount > store->Size()) shape.nodeCount = store->Size();
+		if (stores[b] != store || !SameShape(shapes[b], shape)) sameLayout = false;
+		stores[b] = store;
+		shapes[b] = shape;
+	}
+
+	if (sameLayout) {
+		const int count = (int)x.size();
+		for (int i = 0; i < count; ++i) {
+			const ParticleStore* store = stores[bodyOf[i]];
+			x[i] = store->x[localOf[i]];
+			y[i] = store->y[localOf[i]];
+			invMass[i] = store->invMass[localOf[i]];
+		}
+		return;
+	}
+
+	x.clear(); y.clear(); invMass.clear(); radius.clear();
+	bodyOf.clear(); localOf.clear(); canonOf.clear(); slotOf.clear();
+	edgeA.clear(); edgeB.clear();
+	for (int b = 0; b < bodyCount; ++b) {
+		const ParticleStore* store = stores[b];
+		const CollisionShape& shape = shapes[b];
+		if (shape.nodeCount == 0) continue;
+
+		const int base = (int)x.size();
+		for (int i = 0; i < shape.nodeCount; ++i) {
+			x.push_back(store->x[i]);
+			y.push_back(store->y[i]);
+			invMass.push_back(store->invMass[i]);
+			radius.push_back(shape.radius);
+			bodyOf.push_back(b);
+			localOf.push_back(i);
+			canonOf.push_back(base + i);
+			slotOf.push_back(base + i);
+		}
+		// ܂̕ (Ă΍Ōƍŏ)
+		const int edgeCount = shape.closed ? shape.nodeCount : shape.nodeCount - 1;
+		for (int e = 0; e < edgeCount; ++e) {
+			edgeA.push_back(base + e);
+			edgeB.push_back(base + (e + 1) % shape.nodeCount);
+		}
+	}
+}
+
+void ContactSolver::ReorderByCell(FrameArena& arena) {
+	const std::vector<int>& order = grid.SortedOrder();
+	const int count = (int)x.size();
+	float* scratchFloat = arena.AllocateArray<float>(count);
+	int* scratchInt = arena.AllocateArray<int>(count);
+	Permute(x, order, scratchFloat);
+	Permute(y, order, scratchFloat);
+	Permute(invMass, order, scratchFloat);
+	Permute(radius, order, scratchFloat);
+	Permute(bodyOf, order, scratchInt);
+	Permute(localOf, order, scratchInt);
+	Permute(canonOf, order, scratchInt);
+	for (int i = 0; i < count; ++i) {
+		slotOf[canonOf[i]] = i;
+	}
+	grid.AdoptSortedOrder();
+}
+
+void ContactSolver::Scatter() {
+	const int count = (int)x.size();
+	for (int i = 0; i < count; ++i) {
+		ParticleStore* store = stores[bodyOf[i]];
+		store->x[localOf[i]] = x[i];
+		store->y[localOf[i]] = y[i];
+	}
+}
+
+void ContactSolver::Solve(ISoftBody* const* bodies, int bodyCount, FrameArena& arena) {
+	contactCount = 0;
+	Gather(bodies, bodyCount);
+	const int count = (int)x.size();
+	if (count == 0) return;
+
+	// Z͈ԑ傫_̒a (ڐGg͕Kׂ荇Zɓ)
+	maxRadius = 0.0f;
+	for (int i = 0; i < count; ++i) {
+		if (radius[i] > maxRadius) maxRadius = radius[i];
+	}
+	// ͓Obhg (߂œʂ̓Zɔׂď)
+	grid.Build(x.data(), y.data(), count, maxRadius * 2.0f);
+	// _̂ZɕׂĂƁAߖT̎_łׂ荇
+	// (Z܂_ȂΑO̕т̂܂܂ł悢)
+	if (grid.Rebuilt()) ReorderByCell(arena);
+
+	for (int it = 0; it < iterations; ++it) {
+		SolveParticleContacts();
+		SolveEdgeContacts();
+	}
+	Scatter();
+}
+
+void ContactSolver::SolveParticleContacts() {
+	const int count = (int)x.size();
+	for (int i = 0; i < count; ++i) {
+		const int body = bodyOf[i];
+		grid.ForEachNear(x[i], y[i], [&](int j) {
+			// g1񂾂 (ԍ̏) ׂB̂̑g SolveSelf ŉĂ
+			if ((j <= i) | (bodyOf[j] == body)) return;
+			if (SeparatePair(x.data(), y.data(), invMass.data(), i, j, radius[i] + radius[j])) ++contactCount;
+		});
+	}
+}
+
+void ContactSolver::SolveEdgeContacts() {
+	const int edgeCount = (int)edgeA.size();
+	for (int e = 0; e < edgeCount; ++e) {
+		const int a = slotOf[edgeA[e]], b = slotOf[edgeB[e]];
+		const int body = bodyOf[a];
+		const float edgeRadius = radius[a];
+
+		// ӂ͂ދ`AڐG鋗LĒׂ
+		const float ax = x[a], ay = y[a], bx = x[b], by = y[b];
+		const float reach = edgeRadius + maxRadius;
+		const float minX = ((ax < bx) ? ax : bx) - reach;
+		const float maxX = ((ax < bx) ? bx : ax) + reach;
+		const float minY = ((ay < by) ? ay : by) - reach;
+		const float maxY = ((ay < by) ? by : ay) + reach;
+		grid.ForEachInBox(minX, minY, maxX, maxY, [&](int p) {
+			if (bodyOf[p] == body) return;
+			if (SeparateFromEdge(x.data(), y.data(), invMass.data(), p, a, b, radius[p] + edgeRadius)) ++contactCount;
+		});
+	}
+}
+
+void ContactSolver::SolveSelf(ISoftBody& body, int iterations, FrameArena& arena) {
+	ParticleStore* store = body.GetParticles();
+	const CollisionShape shape = body.GetCollisionShape();
+	if (store == nullptr || shape.radius <= 0.0f) return;
+	const int count = std::min(shape.nodeCount, store->Size());
+	// 3_ȉ̗ւ͂ǂ2_ׂ荇 (J܂3_͗[ڂ)
+	if (count < 3 || (shape.closed && count == 3)) return;
+
+	float* x = store->x.data();
+	float* y = store->y.data();
+	const float* invMass = store->invMass.data();
+	const float minDist = shape.radius * 2.0f;
+	// ׂ荇Ă (łȂĂ) _͍ŏ߂̂ŏ
+	auto adjacent = [&shape, count](int a, int b) {
+		int d = a - b;
+		if (d < 0) d = -d;
+		return d <= 1 || (shape.closed && d == count - 1);
+	};
+
+	// x ̏̕ (͎g񂷁B߂œʂ͐ڐG̋ɔׂď)
+	int* order = arena.AllocateArray<int>(count);
+	float* sortedX = arena.AllocateArray<float>(count);
+	for (int i = 0; i < count; ++i) order[i] = i;
+	std::sort(order, order + count, [x](int a, int b) { return x[a] < x[b]; });
+	for (int k = 0; k < count; ++k) sortedX[k] = x[order[k]];
+
+	const int edgeCount = shape.closed ? count : count - 1;
+	for (int it = 0; it < iterations; ++it) {
+		// _m (x ̍ڐG̋菬g)
+		for (int k = 0; k < count; ++k) {
+			const int i = order[k];
+			for (int m = k + 1; m < count && sortedX[m] - sortedX[k] < minDist; ++m) {
+				const int j = order[m];
+				if (!adjacent(i, j)) SeparatePair(x, y, invMass, i, j, minDist);
+			}
+		}
+		// _ƕ (ӂ͂ދ` x 鎿_)
+		for (int a = 0; a < edgeCount; ++a) {
+			const int b = (a + 1) % count;
+			const float minX = std::min(x[a], x[b]) - minDist;
+			const float maxX = std::max(x[a], x[b]) + minDist;
+			const float minY = std::min(y[a], y[b]) - minDist;
+			const float maxY = std::max(y[a], y[b]) + minDist;
+			for (int k = (int)(std::lower_bound(sortedX, sortedX + count, minX) - sortedX); k < count && sortedX[k] <= maxX; ++k) {
+				const int p = order[k];
+				if (y[p] < minY || y[p] > maxY || adjacent(p, a) || adjacent(p, b)) continue;
+				SeparateFromEdge(x, y, invMass, p, a, b, minDist);
+			}
+		}
+	}
+}
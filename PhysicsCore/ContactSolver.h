@@ -0,0 +1,56 @@
+#pragma once
+#include "FrameArena.h"
+#include "ISoftBody.h"
+#include "SpatialHashGrid.h"
+#include <vector>
+
+// ̓m̏Փ˂܂Ƃ߂ĉ
+// nꂽ̂̏Փ˗p̎_1̔zɏW߁ASpatialHashGrid ŋ߂ɂ̂𒲂ׂ
+// ʁX̂̕ _-_  _- ̐ڐGʒuŉ߂ (PBD ̐ڐG)B
+// ӂ́A[͂ދ`ɂZ̎_𒲂ׂB
+// nꂽ̂̎_ɏނ̂ŁÂ܂ Solve 𓯎ɌĂ΂ȂƁB
+// PhysicsWorld ͕܋`dȂ镨̂̂܂Ƃ܂ () ƂɃCX^X𕪂ĕɌĂԁB
+// ̎g̐ڐG (SolveSelf) ͑̂̕ɐGȂ̂ŁÂƂ̏Փ˃tF[Yŕɉ
+class ContactSolver {
+public:
+	// בւ̍Ɨp̔z arena ؂o
+	void Solve(ISoftBody* const* bodies, int bodyCount, FrameArena& arena);
+	// body ǵAׂ荇ĂȂ_m _- ̐ڐG iterations 
+	// _͑ĂSȂ̂ŁAx ̏ɕׂċ߂̂𑍓Œׂ (Ɨp̔z arena )
+	static void SolveSelf(ISoftBody& body, int iterations, FrameArena& arena);
+
+	// ڐG (dȂ肪[Ƃ͑₷)
+	void SetIterations(int count) { iterations = (count < 1) ? 1 : count; }
+	int Iterations() const { return iterations; }
+
+	// O Solve ̌ (vp)
+	int ParticleCount() const { return (int)x.size(); }
+	int ContactCount() const { return contactCount; }
+
+private:
+	// W߂_ (SoA)BObh̃ZɕבւĎA Solve ł̕тg
+	FloatArray x, y, invMass, radius;
+	std::vector<int> bodyOf;   // _  ̔ԍ
+	std::vector<int> localOf;  // _  ̓̔ԍ
+	std::vector<int> canonOf;  // _  בւO̔ԍ (̏E̓̔ԍ)
+	std::vector<int> slotOf;   // בւO̔ԍ  _
+	// W߂ (בւO̔ԍ̑g)
+	std::vector<int> edgeA, edgeB;
+	// ̂Ƃ̏
+	std::vector<ParticleStore*> stores;
+	std::vector<CollisionShape> shapes;
+
+	SpatialHashGrid grid;
+	float maxRadius = 0.0f;
+	int iterations = 1;
+	int contactCount = 0;
+
+	// Ŝ̏Փ˗p̎_W߂
+	// ̂̕тƌ`󂪑OƓȂAO̕т̂܂܈ʒuǂݒ
+	void Gather(ISoftBody* const* bodies, int bodyCount);
+	// Obh̃ZɎ_בւ
+	void ReorderByCell(FrameArena& arena);
+	void Scatter();
+	void SolveParticleContacts();
+	void SolveEdgeContacts();
+};
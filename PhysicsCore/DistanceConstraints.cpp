@@ -0,0 +1,307 @@
+#include "DistanceConstraints.h"
+#include "ConstraintKernels.h"
+#include "SimdSupport.h"
+#include <cmath>
+#include <cstdint>
+
+namespace {
+	// F̐̏ (ւ⍽Ȃ3Fő)B肫Ȃ͍ṒuƗłȂvob`ɓ
+	const int MAX_COLOURS = 32;
+}
+
+void DistanceConstraints::Reserve(int count) {
+	i0.reserve(count);
+	i1.reserve(count);
+	rest.reserve(count);
+	w0.reserve(count);
+	w1.reserve(count);
+	compliance.reserve(count);
+	lambda.reserve(count);
+	ids.reserve(count);
+	slotOf.reserve(count);
+}
+
+void DistanceConstraints::Clear() {
+	i0.clear();
+	i1.clear();
+	rest.clear();
+	w0.clear();
+	w1.clear();
+	compliance.clear();
+	lambda.clear();
+	ids.clear();
+	slotOf.clear();
+	layoutDirty = true;
+}
+
+int DistanceConstraints::Add(int a, int b, float restLength, float weightA, float weightB, float complianceValue) {
+	const int id = Size();
+	i0.push_back(a);
+	i1.push_back(b);
+	rest.push_back(restLength);
+	w0.push_back(weightA);
+	w1.push_back(weightB);
+	compliance.push_back(complianceValue);
+	lambda.push_back(0.0f);
+	ids.push_back(id);
+	slotOf.push_back(id);
+	layoutDirty = true;
+	return id;
+}
+
+void DistanceConstraints::SetWeights(int id, float weightA, float weightB) {
+	const int c = slotOf[id];
+	// 0 ǂςƁAǂ̓_𓮂ς̂ŐF蒼
+	if ((w0[c] != 0.0f) != (weightA != 0.0f) || (w1[c] != 0.0f) != (weightB != 0.0f)) {
+		layoutDirty = true;
+	}
+	w0[c] = weightA;
+	w1[c] = weightB;
+}
+
+void DistanceConstraints::SetRestLength(int id, float restLength) {
+	rest[slotOf[id]] = restLength;
+}
+
+void DistanceConstraints::SetCompliance(int id, float complianceValue) {
+	compliance[slotOf[id]] = complianceValue;
+}
+
+void DistanceConstraints::SetAllCompliance(float complianceValue) {
+	for (float& value : compliance) value = complianceValue;
+}
+
+void DistanceConstraints::ResetLambdas() {
+	for (float& value : lambda) value = 0.0f;
+}
+
+void DistanceConstraints::SetOrder(ConstraintOrder newOrder) {
+	if (order != newOrder) {
+		order = newOrder;
+		layoutDirty = true;
+	}
+}
+
+void DistanceConstraints::Prepare() {
+	if (layoutDirty) BuildLayout();
+}
+
+void DistanceConstraints::Permute(const std::vector<int>& newToOldSlot) {
+	const int n = Size();
+	std::vector<int> newI0(n), newI1(n), newIds(n);
+	FloatArray newRest(n), newW0(n), newW1(n), newCompliance(n), newLambda(n);
+	for (int c = 0; c < n; ++c) {
+		const int old = newToOldSlot[c];
+		newI0[c] = i0[old];
+		newI1[c] = i1[old];
+		newRest[c] = rest[old];
+		newW0[c] = w0[old];
+		newW1[c] = w1[old];
+		newCompliance[c] = compliance[old];
+		newLambda[c] = lambda[old];
+		newIds[c] = ids[old];
+	}
+	i0.swap(newI0);
+	i1.swap(newI1);
+	rest.swap(newRest);
+	w0.swap(newW0);
+	w1.swap(newW1);
+	compliance.swap(newCompliance);
+	lambda.swap(newLambda);
+	ids.swap(newIds);
+	for (int c = 0; c < n; ++c) {
+		slotOf[ids[c]] = c;
+	}
+}
+
+void DistanceConstraints::BuildLayout() {
+	const int n = Size();
+
+	// ܂ǉ (ID) ɖ߂
+	std::vector<int> byId(n);
+	for (int id = 0; id < n; ++id) byId[id] = slotOf[id];
+	Permute(byId);
+
+	// ID×~@ŐF߂
+	// _ƂɁu̓_𓮂̐FvƁu̓_g̐FvrbgŎA
+	// _gFEg_𓮂F
+	int particleCount = 0;
+	for (int c = 0; c < n; ++c) {
+		if (i0[c] + 1 > particleCount) particleCount = i0[c] + 1;
+		if (i1[c] + 1 > particleCount) particleCount = i1[c] + 1;
+	}
+	std::vector<uint32_t> writtenBy(particleCount, 0);
+	std::vector<uint32_t> touchedBy(particleCount, 0);
+	std::vector<int> colour(n);
+	int colourCount = 0;
+	for (int c = 0; c < n; ++c) {
+		const int a = i0[c];
+		const int b = i1[c];
+		uint32_t used = 0;
+		if (w0[c] != 0.0f) used |= touchedBy[a];
+		else used |= writtenBy[a];
+		if (w1[c] != 0.0f) used |= touchedBy[b];
+		else used |= writtenBy[b];
+
+		int k = 0;
+		while (k < MAX_COLOURS && (used & (1u << k)) != 0) ++k;
+		colour[c] = k;
+		if (k + 1 > colourCount) colourCount = k + 1;
+		if (k == MAX_COLOURS) continue;
+
+		const uint32_t bit = 1u << k;
+		touchedBy[a] |= bit;
+		touchedBy[b] |= bit;
+		if (w0[c] != 0.0f) writtenBy[a] |= bit;
+		if (w1[c] != 0.0f) writtenBy[b] |= bit;
+	}
+
+	batchStart.clear();
+	batchIndependent.clear();
+	if (order == ConstraintOrder::Sequential) {
+		// т͂̂܂܁BS1FɎ܂ƂƗ
+		batchStart.push_back(0);
+		batchStart.push_back(n);
+		batchIndependent.push_back(colourCount <= 1 ? 1 : 0);
+	}
+	else {
+		// FƂɂ܂Ƃ߂ (F̒ ID ̂܂)
+		std::vector<int> newToOld;
+		newToOld.reserve(n);
+		for (int k = 0; k < colourCount; ++k) {
+			batchStart.push_back((int)newToOld.size());
+			batchIndependent.push_back(k < MAX_COLOURS ? 1 : 0);
+			for (int c = 0; c < n; ++c) {
+				if (colour[c] == k) newToOld.push_back(c);
+			}
+		}
+		batchStart.push_back(n);
+		if (colourCount == 0) batchIndependent.push_back(0);
+		Permute(newToOld);
+	}
+
+	BuildBlockInfo();
+	layoutDirty = false;
+}
+
+bool DistanceConstraints::IsIndependent(int begin, int count) const {
+	// SIMD ł̓ubN̑S񂪏CÖʒuǂނ̂ŁA
+	// O̐񂪓_̐񂪓ǂݏĂƒvZƌʂς
+	// (O̐񂪓ǂނ̓_̐񂪓̂́AvZłlǂނ̂ŖȂ)
+	for (int p = begin; p < begin + count; ++p) {
+		for (int q = p + 1; q < begin + count; ++q) {
+			if (w0[p] != 0.0f && (i0[p] == i0[q] || i0[p] == i1[q])) return false;
+			if (w1[p] != 0.0f && (i1[p] == i0[q] || i1[p] == i1[q])) return false;
+		}
+	}
+	return true;
+}
+
+void DistanceConstraints::BuildBlockInfo() {
+	const int n = Size();
+	block4Independent.assign(n / 4, 0);
+	block8Independent.assign(n / 8, 0);
+	for (int b = 0; b < n / 4; ++b) {
+		block4Independent[b] = IsIndependent(b * 4, 4) ? 1 : 0;
+	}
+	for (int b = 0; b < n / 8; ++b) {
+		block8Independent[b] = (block4Independent[b * 2] && block4Independent[b * 2 + 1]
+			&& IsIndependent(b * 8, 8)) ? 1 : 0;
+	}
+}
+
+bool DistanceConstraints::InIndependentBatch(int begin, int end) const {
+	for (int b = 0; b < BatchCount(); ++b) {
+		if (begin >= BatchBegin(b) && begin < BatchEnd(b)) {
+			return BatchIndependent(b) && end <= BatchEnd(b);
+		}
+	}
+	return false;
+}
+
+// ߃ZbgƂ̃J[l̑g
+struct DistanceConstraints::KernelSet {
+	void (*scalar)(const DistanceKernelArgs&, int);
+	void (*sse2x4)(const DistanceKernelArgs&, int);
+	void (*avx2x8)(const DistanceKernelArgs&, int);
+};
+
+void DistanceConstraints::Solve(ParticleStore& particles, ConstraintError* error) {
+	Prepare();
+	for (int b = 0; b < BatchCount(); ++b) {
+		SolveBatch(particles, b, error);
+	}
+}
+
+void DistanceConstraints::SolveBatch(ParticleStore& particles, int b, ConstraintError* error) {
+	SolveRange(particles, BatchBegin(b), BatchEnd(b), error);
+}
+
+void DistanceConstraints::SolveRange(ParticleStore& particles, int begin, int end, ConstraintError* error) {
+	static const KernelSet kernels = { SolveDistanceScalar, SolveDistanceSSE2x4, SolveDistanceAVX2x8 };
+	RunKernels(particles, begin, end, 0.0f, error, kernels);
+}
+
+void DistanceConstraints::SolveXPBD(ParticleStore& particles, float dt, ConstraintError* error) {
+	Prepare();
+	for (int b = 0; b < BatchCount(); ++b) {
+		SolveBatchXPBD(particles, b, dt, error);
+	}
+}
+
+void DistanceConstraints::SolveBatchXPBD(ParticleStore& particles, int b, float dt, ConstraintError* error) {
+	SolveRangeXPBD(particles, BatchBegin(b), BatchEnd(b), dt, error);
+}
+
+void DistanceConstraints::SolveRangeXPBD(ParticleStore& particles, int begin, int end, float dt, ConstraintError* error) {
+	static const KernelSet kernels = { SolveDistanceXPBDScalar, SolveDistanceXPBDSSE2x4, SolveDistanceXPBDAVX2x8 };
+	RunKernels(particles, begin, end, dt, error, kernels);
+}
+
+void DistanceConstraints::RunKernels(ParticleStore& particles, int begin, int end, float dt, ConstraintError* error, const KernelSet& kernels) {
+	Prepare();
+
+	DistanceKernelArgs args;
+	args.x = particles.x.data();
+	args.y = particles.y.data();
+	args.i0 = i0.data();
+	args.i1 = i1.data();
+	args.rest = rest.data();
+	args.w0 = w0.data();
+	args.w1 = w1.data();
+	args.lambda = lambda.data();
+	args.compliance = compliance.data();
+	args.invDtSq = (dt > 0.0f) ? 1.0f / (dt * dt) : 0.0f;
+	args.error = error;
+
+	const SimdLevel level = GetSimdLevel();
+	int c = begin;
+
+	// Ɨȃob`̒ȂAǂn߂Ă SIMD ł܂Ƃ߂ĉ
+	if (InIndependentBatch(begin, end)) {
+		if (level >= SimdLevel::AVX2) {
+			for (; c + 8 <= end; c += 8) kernels.avx2x8(args, c);
+		}
+		if (level >= SimdLevel::SSE2) {
+			for (; c + 4 <= end; c += 4) kernels.sse2x4(args, c);
+		}
+		for (; c < end; ++c) kernels.scalar(args, c);
+		return;
+	}
+
+	while (c < end) {
+		// ubN̐擪ɂāAubN͈͂Ɏ܂AƗȂ SIMD ŉ
+		if (level >= SimdLevel::AVX2 && (c % 8) == 0 && c + 8 <= end && block8Independent[c / 8]) {
+			kernels.avx2x8(args, c);
+			c += 8;
+		}
+		else if (level >= SimdLevel::SSE2 && (c % 4) == 0 && c + 4 <= end && block4Independent[c / 4]) {
+			kernels.sse2x4(args, c);
+			c += 4;
+		}
+		else {
+			kernels.scalar(args, c);
+			c += 1;
+		}
+	}
+}
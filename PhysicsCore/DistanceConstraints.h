@@ -0,0 +1,110 @@
+#pragma once
+#include "ParticleStore.h"
+#include "SolverConvergence.h"
+#include <vector>
+
+// 
+enum class ConstraintOrder {
+	Sequential, // ǉ Gauss-Seidel ŉ (̒[vƓ)
+	Coloured,   // _LȂ񂲂ƂɃob` (F) ɕAF̏ɉ
+};
+
+// ̉
+enum class SolverMode {
+	PBD,  // Cʂ w0, w1 ŕz] PBD (d͔񐔂Ō܂)
+	XPBD, // w0, w1 ʂ̋tAcompliance _炩ƂĈ XPBD (d͔񐔂Ɉ˂Ȃ)
+};
+
+// SIMD J[lƃXJ[1̏C̍̏ (rest * d ɑ΂BɈʒůۂ 1ulp )
+constexpr float DISTANCE_SIMD_REST_ERROR = 2.5e-7f;
+
+// 2_Ԃ̋ Structure of Arrays ŎRei
+//  c  i0[c]  i1[c] ̋ rest[c] ɋ߂ÂB
+// 1̏Cʂ diff * (D-L)/D ŁAi0  w0 {Ai1  w1 {𑫂
+// (w0, w1 ͎ʂ̋tƍ|zB0 Ȃ炻̓_͓Ȃ)
+//
+// Sequential ł͐т̏ Gauss-Seidel ŉB
+// 4 (SSE2) / 8 (AVX2) ̃ubNŁAO̐񂪓_̐񂪎gȂꍇ
+// ̃ubN SIMD ł܂Ƃ߂ČvẐŁAʂ͒vZƓ̈ӖۂB
+// SIMD  1/D  rsqrt + Newton 1ŋ߂邽߁AXJ[Ƃ̍1̏C
+// rest * d * DISTANCE_SIMD_REST_ERROR ƈʒůۂ 1ulp ܂ŁBXebvd˂ƍ͍LA
+// O͈vȂ (ڂ ConstraintKernels.h)
+//
+// Coloured ł́A_𑼂̐񂪓ǂݏȂ񓯎m𓯂Fɂ܂Ƃ߂
+// (ǉ×~@Ȃ̂ŁAւȂԖځEԖځE̂Ƃ̌pڂ3FɂȂ)B
+// F̒͂ǂ̏ŉĂʂȂ̂ŁAFƂ SIMD ╡XbhŉB
+// F͒ǉŌ܂̂ŁAx蒼ĂтɂȂ (vCłv)
+//
+// XPBD ł compliance[c] (0 ȂLтȂ) ƗݐσOW搔 lambda[c] gB
+// lambda ̓TuXebv̍ŏ ResetLambdas  0 ɖ߂
+//
+// i0 ` lambda ̔z͉ (Xbg) ɕłBAdd Ԃԍ͐IDŁA
+// SetWeights / SetRestLength  ID Ŏw肷
+class DistanceConstraints {
+public:
+	std::vector<int> i0, i1;
+	FloatArray rest;
+	FloatArray w0, w1;
+	FloatArray compliance;
+	FloatArray lambda;
+
+	void Reserve(int count);
+	void Clear();
+	// ǉĂIDԂ
+	int Add(int a, int b, float restLength, float weightA, float weightB, float complianceValue = 0.0f);
+	int Size() const { return (int)i0.size(); }
+
+	void SetWeights(int id, float weightA, float weightB);
+	void SetRestLength(int id, float restLength);
+	void SetCompliance(int id, float complianceValue);
+	void SetAllCompliance(float complianceValue);
+
+	void SetOrder(ConstraintOrder newOrder);
+	ConstraintOrder Order() const { return order; }
+
+	// בւƃubNς܂ (Solve KvȂĂԁBɉO1ĂԂ)
+	void Prepare();
+
+	// ob` (Sequential ȂŜ1AColoured ȂF)
+	int BatchCount() const { return (int)batchStart.size() - 1; }
+	int BatchBegin(int b) const { return batchStart[b]; }
+	int BatchEnd(int b) const { return batchStart[b + 1]; }
+	// ob`̐񂪌݂ɓƗ (ǂ̏ŉĂ) 
+	bool BatchIndependent(int b) const { return batchIndependent[b] != 0; }
+
+	// S1񂸂
+	// error nƁAe𒼂Ő rest ̍ɑ (ł؂邩̔fƌvɎg)
+	void Solve(ParticleStore& particles, ConstraintError* error = nullptr);
+	// ob` b 
+	void SolveBatch(ParticleStore& particles, int b, ConstraintError* error = nullptr);
+	// Xbg [begin, end) ̐񂾂 (Ɨȃob`̈ꕔȂ SIMD ł܂Ƃ߂ĉ)
+	void SolveRange(ParticleStore& particles, int begin, int end, ConstraintError* error = nullptr);
+
+	// --- XPBD (dt ̓TuXebv̎ԕ) ---
+	void ResetLambdas();
+	void SolveXPBD(ParticleStore& particles, float dt, ConstraintError* error = nullptr);
+	void SolveBatchXPBD(ParticleStore& particles, int b, float dt, ConstraintError* error = nullptr);
+	void SolveRangeXPBD(ParticleStore& particles, int begin, int end, float dt, ConstraintError* error = nullptr);
+
+private:
+	ConstraintOrder order = ConstraintOrder::Sequential;
+	std::vector<int> ids;    // Xbg  ID
+	std::vector<int> slotOf; // ID  Xbg
+
+	std::vector<int> batchStart = { 0, 0 };
+	std::vector<unsigned char> batchIndependent = { 0 };
+
+	// 4 / 8Pʂ̃ubN SIMD ŉ邩 (CfbNX c / 4, c / 8)
+	std::vector<unsigned char> block4Independent;
+	std::vector<unsigned char> block8Independent;
+	bool layoutDirty = true;
+
+	struct KernelSet;
+	void RunKernels(ParticleStore& particles, int begin, int end, float dt, ConstraintError* error, const KernelSet& kernels);
+
+	void BuildLayout();
+	void BuildBlockInfo();
+	void Permute(const std::vector<int>& newToOldSlot);
+	bool IsIndependent(int begin, int count) const;
+	bool InIndependentBatch(int begin, int end) const;
+};
@@ -0,0 +1,80 @@
+#include "FrameArena.h"
+#include <cstdint>
+#include <new>
+
+namespace {
+	std::size_t AlignUp(std::size_t value, std::size_t alignment) {
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+FrameArena::FrameArena(std::size_t capacity)
+	:capacity(capacity)
+{
+	if (capacity > 0) buffer = static_cast<unsigned char*>(::operator new(capacity));
+}
+
+FrameArena::~FrameArena() {
+	FreeOverflow();
+	::operator delete(buffer);
+}
+
+void* FrameArena::Allocate(std::size_t bytes, std::size_t alignment) {
+	if (bytes == 0) bytes = 1;
+	// AhXł낦 (buffer ̂ max_align_t ܂łĂȂ)
+	const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer);
+	std::size_t current = offset.load(std::memory_order_relaxed);
+	for (;;) {
+		const std::size_t begin = AlignUp(base + current, alignment) - base;
+		const std::size_t end = begin + bytes;
+		if (end > capacity) break;
+		if (offset.compare_exchange_weak(current, end, std::memory_order_relaxed)) {
+			return buffer + begin;
+		}
+	}
+	return AllocateOverflow(bytes, alignment);
+}
+
+void* FrameArena::AllocateOverflow(std::size_t bytes, std::size_t alignment) {
+	// wb_̌ alignment ɂ낦邾]Ɏ
+	const std::size_t header = AlignUp(sizeof(OverflowBlock), alignof(std::max_align_t));
+	unsigned char* raw = static_cast<unsigned char*>(::operator new(header + bytes + alignment));
+	OverflowBlock* block = reinterpret_cast<OverflowBlock*>(raw);
+	const std::uintptr_t data = AlignUp(reinterpret_cast<std::uintptr_t>(raw) + header, alignment);
+
+	overflowBytes.fetch_add(bytes + alignment, std::memory_order_relaxed);
+	overflowCount.fetch_add(1, std::memory_order_relaxed);
+	std::lock_guard<std::mutex> lock(overflowMutex);
+	block->next = overflowBlocks;
+	overflowBlocks = block;
+	return reinterpret_cast<void*>(data);
+}
+
+void FrameArena::FreeOverflow() {
+	std::lock_guard<std::mutex> lock(overflowMutex);
+	while (overflowBlocks) {
+		OverflowBlock* next = overflowBlocks->next;
+		::operator delete(overflowBlocks);
+		overflowBlocks = next;
+	}
+}
+
+std::size_t FrameArena::Used() const {
+	return offset.load(std::memory_order_relaxed) + overflowBytes.load(std::memory_order_relaxed);
+}
+
+void FrameArena::Reset() {
+	const std::size_t used = Used();
+	if (used > highWater) highWater = used;
+
+	// ꂽt[A͎܂悤ɍL (L̂͂Ȃ̂Ŋmۂ͂܂)
+	if (overflowBytes.load(std::memory_order_relaxed) > 0) {
+		FreeOverflow();
+		const std::size_t newCapacity = highWater + highWater / 2;
+		::operator delete(buffer);
+		buffer = static_cast<unsigned char*>(::operator new(newCapacity));
+		capacity = newCapacity;
+		overflowBytes.store(0, std::memory_order_relaxed);
+	}
+	offset.store(0, std::memory_order_relaxed);
+}
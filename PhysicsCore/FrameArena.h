@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+
+// 1t[̊ԂgƗp؂o`AP[^
+// mۂ͐擪|C^i߂邾ŁAʂ̉͂Ȃ Reset ł܂Ƃ߂Ď̂ĂB
+// ̈𖈃t[g񂷂̂ŁAƗp̔z񂪃q[vɐGꂸLbVɂc₷B
+//
+// Allocate ͕̃Xbh瓯ɌĂł悢 (ItZbg CAS Ői߂)B
+// Reset ͒N Allocate ĂȂƂ (t[̐擪) 1XbhĂԂƁB
+// eʂȂƂ̓q[vmۂĂ̂A Reset ł̃t[̍őʂɍ킹čL
+class FrameArena {
+public:
+	static const std::size_t DEFAULT_CAPACITY = 1 << 20;
+
+	explicit FrameArena(std::size_t capacity = DEFAULT_CAPACITY);
+	~FrameArena();
+
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	// alignment  2 ׂ̂
+	void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+	// ĂȂ T ̔z (fXgN^͌Ă΂Ȃ̂ŁAn̂Ȃ^)
+	template<class T>
+	T* AllocateArray(std::size_t count) {
+		static_assert(std::is_trivially_destructible<T>::value, "FrameArena ͌n̂Ȃ^u");
+		return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	// t[ɐ؂oׂĎ̂Ă (Õt[̃|C^͂ȍ~gȂ)
+	void Reset();
+
+	std::size_t Capacity() const { return capacity; }
+	// t[ɐ؂o (eʂ𒴂ăq[vmۂ܂)
+	std::size_t Used() const;
+	// ܂ł Used ̍ő
+	std::size_t HighWater() const { return highWater; }
+	// eʂ肸Ƀq[vmۂ (NĂ̍v)
+	unsigned int OverflowCount() const { return overflowCount.load(std::memory_order_relaxed); }
+
+private:
+	// eʂ𒴂̊m (ubN̐擪ɂ̃wb_uĒPXgłȂ)
+	struct OverflowBlock {
+		OverflowBlock* next;
+	};
+
+	unsigned char* buffer = nullptr;
+	std::size_t capacity = 0;
+	std::atomic<std::size_t> offset{ 0 };
+	std::size_t highWater = 0;
+
+	std::mutex overflowMutex;
+	OverflowBlock* overflowBlocks = nullptr;
+	std::atomic<std::size_t> overflowBytes{ 0 };
+	std::atomic<unsigned int> overflowCount{ 0 };
+
+	void* AllocateOverflow(std::size_t bytes, std::size_t alignment);
+	void FreeOverflow();
+};
+
+// 1t[ (GameManager::Update 1) ̊ԁAV[ƕɓn
+// t[܂Ŏẑ͓Ȃ
+struct FrameContext {
+	FrameArena* arena = nullptr;	// t[̐擪 Reset Ɨp
+	unsigned int frameNumber = 0;
+};
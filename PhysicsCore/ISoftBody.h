@@ -0,0 +1,164 @@
+#pragma once
+#include "BodyControl.h"
+#include "ParticleStore.h"
+#include "Profiler.h"
+#include "SolverConvergence.h"
+#include "WorldSnapshot.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+class StaticColliderSet;
+
+// FNV-1a  data  bytes oCg (4̔{) 32rbg hash ɍ
+// float  double ͒lł͂Ȃrbgō (-0  +0 ʂ)
+inline uint32_t HashStateBits(uint32_t hash, const void* data, size_t bytes) {
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i + 4 <= bytes; i += 4) {
+		uint32_t bits;
+		std::memcpy(&bits, p + i, sizeof(bits));
+		hash = (hash ^ bits) * 16777619u;
+	}
+	return hash;
+}
+
+// ̓m̏Փ˂Ɏg`
+// _ 0 ` nodeCount-1 ɂȂ܂ (closed ȂŌƍŏȂ) A
+// a radius ̉~ׂ̂ƂĈBradius  0 ̂̕͏Փ˂Ȃ
+struct CollisionShape {
+	int nodeCount = 0;
+	bool closed = false;
+	float radius = 0.0f;
+};
+
+// ̂~܂Ă邩 PhysicsWorld ׂ邽߂̏ (͓̂ǂݏȂ)
+struct BodySleepState {
+	bool sleeping = false;
+	float restTime = 0.0f;			// lÂȏԂĂ鎞 (b)
+	float anchorX = 0.0f;			// ÂɂȂn߂Ƃ̏dS (炸ꂽ琔)
+	float anchorY = 0.0f;
+	float minX = 0.0f, minY = 0.0f;	// Փ˂̔a܂ōL܋` (ĂԂ͖Ƃ̂܂)
+	float maxX = -1.0f, maxY = -1.0f;
+	float motion = 0.0f;			// ÕXebvŎ_̍ő
+};
+
+// PhysicsWorld i߂镨̂̃C^tF[X
+// 1Xebv͎4tF[YɕĂāAPhysicsWorld ͑Ŝ̃tF[Y
+// I܂ő҂Ă玟̃tF[Yɐi (tF[YԂoAɂȂ)B
+// 1̂̊̕etF[Y͓1Xbh炵Ă΂ȂA
+// ʁX̂̃̕tF[Y͕ɌĂ΂̂ŁA̎ȊO͏Ȃ
+class ISoftBody {
+public:
+	virtual ~ISoftBody() = default;
+
+	// ̃XebvŎg (삵Ȃ͖̂Ă悢)
+	virtual void SetControl(const BodyControl& control) {}
+
+	// XebvȌԂ`ԗpɕۑ (Integrate ̒OɌĂ΂)
+	virtual void SaveRenderState() {
+		if (ParticleStore* particles = GetParticles()) particles->SaveRenderState();
+	}
+
+	// tF[Y1: ́EO͂KpĈʒu\
+	virtual void Integrate(float dt) = 0;
+	// tF[Y2: ̓̐
+	virtual void SolveConstraints() = 0;
+	// tF[Y3:  (staticColliders) Ƃ̏Փ˂
+	// (̓m̏Փ˂́AŜ̂̃tF[YI PhysicsWorld ܂Ƃ߂ĉ)
+	virtual void SolveCollisions() {}
+	// tF[Y4: C̈ʒu瑬x߂
+	virtual void UpdateVelocities(float dt) {}
+
+	// `pɃRs[_̐ƁÃRs[ (PhysicsWorld::PublishSnapshot Xebv̊ԂɌĂ)
+	// ͎_̂܂܎gB_Ȃ͕̂`Ɏg_ŏ
+	virtual int RenderPointCount() {
+		ParticleStore* particles = GetParticles();
+		return particles ? particles->Size() : 0;
+	}
+	virtual void WriteRenderPoints(SnapshotPoint* out) {
+		if (ParticleStore* particles = GetParticles()) particles->WriteSnapshot(out);
+	}
+
+	// _̂͂Ԃ (ol̂悤ɎȂ̂ nullptr)
+	virtual ParticleStore* GetParticles() { return nullptr; }
+	// ʂ߂ (ʒuƑx)  hash ɍĕԂ (PhysicsWorld::StateHash Ŝ̕ɍ)
+	// ͎_ x, y, vx, vyB_Ȃ͎̂̏Ԃ邱
+	virtual uint32_t HashState(uint32_t hash) {
+		ParticleStore* particles = GetParticles();
+		if (!particles) return hash;
+		const size_t bytes = sizeof(float) * particles->Size();
+		hash = HashStateBits(hash, particles->x.data(), bytes);
+		hash = HashStateBits(hash, particles->y.data(), bytes);
+		hash = HashStateBits(hash, particles->vx.data(), bytes);
+		return HashStateBits(hash, particles->vy.data(), bytes);
+	}
+	// ̓m̏Փ˂Ɏg` (͏Փ˂Ȃ)
+	virtual CollisionShape GetCollisionShape() const { return {}; }
+	// 1̔ŉ̐ (vpBx`Ő񂠂̎ԂôɎg)
+	virtual int ConstraintCount() const { return 0; }
+	// 1Xebv (TuXebv) Ő񐔂̏ (vpBȂ̂ 0)
+	virtual int IterationLimit() const { return 0; }
+
+	// x̐ÓIȓ蔻 (PhysicsWorld::CreateBody nBSolveCollisions Ŏg)
+	void SetStaticColliders(const StaticColliderSet* colliders) { staticColliders = colliders; }
+
+	// ̑ł؂ (PhysicsWorld::CreateBody nBnullptr Ȃ猈܂񐔂)
+	void SetConvergence(const ConvergenceSettings* settings) { convergence = settings; }
+	// ÕXebvŉ񂵂̉񐔂ƁAIƂ̈ᔽ (Xebv̍ŏ PhysicsWorld )
+	const SolverStats& LastSolveStats() const { return solveStats; }
+	void ResetSolveStats() { solveStats = SolverStats(); }
+
+	// ~܂Ɣfꂽ̂́AN܂ PhysicsWorld ̃XebvŉȂ
+	// (͂ƂENĂ镨̂߂ÂƂE蔻肪ςƂɋN)
+	bool IsSleeping() const { return sleepState.sleeping; }
+	// Ă΋NA~܂Ă鎞Ԃ𐔂 (삷镨̂ SetControl œ͂ΌĂ)
+	void Wake() { sleepState.sleeping = false; sleepState.restTime = 0.0f; }
+	// 点Ă悢̂ (͎_́B_Ȃol͎~܂𒲂ׂȂ)
+	virtual bool CanSleep() { return GetParticles() != nullptr; }
+
+protected:
+	const StaticColliderSet* staticColliders = nullptr; // nullptr ȂÓIȓ蔻͂Ȃ
+	const ConvergenceSettings* convergence = nullptr;
+	SolverStats solveStats;
+
+	// solve(error) Ő1񂸂Aő maxIterations ܂ŌJԂ
+	// solve ͊e𒼂Öᔽ error (ConstraintError*) ɑBʂgȂł nullptr nB
+	// minIterations 񂵂́A̔őᔽ tolerance ȉɂȂ邩
+	// Ԑ؂ɂȂƂł߂BŌ̈ᔽ solveStats Ɏc
+	// (Ȃ瑪̂ŁAᔽ͒O̒lɂȂBɋCÂ̂́AIĂ瑪ꍇ1x)
+	template<class Solve>
+	void Iterate(int maxIterations, Solve&& solve) {
+		const ConvergenceSettings* settings = convergence;
+		const bool earlyExit = settings && settings->tolerance > 0.0f;
+		const bool budget = settings && settings->deadline != 0;
+		int minIterations = settings ? settings->minIterations : maxIterations;
+		if (minIterations > maxIterations) minIterations = maxIterations;
+
+		int done = 0;
+		ConstraintError error;
+		while (done < maxIterations) {
+			// ł؂𒲂ׂ锽ƍŌ̔
+			// (PhysicsWorld ̊OŐݒȂŉƂ́Ał؂Ȃ̂őȂ)
+			const bool last = done + 1 == maxIterations;
+			const bool check = done + 1 >= minIterations && (earlyExit || budget);
+			const bool measure = settings && (last || check);
+			if (measure) error = ConstraintError();
+			solve(measure ? &error : nullptr);
+			++done;
+			if (done < minIterations || done == maxIterations) continue;
+			// Ԑ؂ȂAc͎̔̃XebvɔC (̕_炩)
+			if (budget && Profiler::Now() > settings->deadline) {
+				solveStats.timedOut++;
+				break;
+			}
+			if (earlyExit && error.max <= settings->tolerance) break;
+		}
+		solveStats.iterations += done;
+		solveStats.maxError = error.max;
+		solveStats.rmsError = error.Rms();
+	}
+
+private:
+	friend class PhysicsWorld;
+	BodySleepState sleepState;
+};
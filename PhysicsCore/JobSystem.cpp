@@ -0,0 +1,135 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+
+namespace {
+	// ̃XbhgL[̔ԍ ([J[ȊO 0)
+	thread_local int t_queueIndex = 0;
+}
+
+void JobSystem::WorkQueue::Push(const Job& job) {
+	std::lock_guard<std::mutex> lock(mutex);
+	jobs.push_back(job);
+}
+
+bool JobSystem::WorkQueue::PopBack(Job& job) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (jobs.size() <= head) return false;
+	job = jobs.back();
+	jobs.pop_back();
+	if (jobs.size() <= head) {
+		jobs.clear();
+		head = 0;
+	}
+	return true;
+}
+
+bool JobSystem::WorkQueue::StealFront(Job& job) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (jobs.size() <= head) return false;
+	job = jobs[head++];
+	if (jobs.size() <= head) {
+		jobs.clear();
+		head = 0;
+	}
+	return true;
+}
+
+JobSystem::JobSystem(int workerCount) {
+	if (workerCount <= 0) {
+		int hardware = (int)std::thread::hardware_concurrency();
+		workerCount = (hardware > 1) ? hardware - 1 : 0;
+	}
+	for (int i = 0; i <= workerCount; ++i) {
+		queues.push_back(std::make_unique<WorkQueue>());
+	}
+	for (int i = 1; i <= workerCount; ++i) {
+		workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		quit = true;
+	}
+	wakeUp.notify_all();
+	for (std::thread& t : workers) {
+		t.join();
+	}
+}
+
+void JobSystem::Execute(const Job& job) {
+	{
+		PROFILE_SCOPE("Job");
+		job.fn(job.context, job.begin, job.end);
+	}
+	job.remaining->fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool JobSystem::RunOne(int queueIndex) {
+	Job job;
+	if (!queues[queueIndex]->PopBack(job)) {
+		// ̎̃L[珇ɓ݂ɍs
+		const int queueCount = (int)queues.size();
+		bool stolen = false;
+		for (int k = 1; k < queueCount && !stolen; ++k) {
+			stolen = queues[(queueIndex + k) % queueCount]->StealFront(job);
+		}
+		if (!stolen) return false;
+	}
+	queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+	Execute(job);
+	return true;
+}
+
+void JobSystem::WorkerLoop(int queueIndex) {
+	t_queueIndex = queueIndex;
+	Profiler::SetThreadName("Worker");
+	while (true) {
+		if (RunOne(queueIndex)) continue;
+
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		wakeUp.wait(lock, [this] { return quit.load() || queuedJobs.load() > 0; });
+		if (quit) return;
+	}
+}
+
+void JobSystem::Run(int count, int grainSize, const void* context, JobFunction fn) {
+	if (count <= 0) return;
+	if (grainSize < 1) grainSize = 1;
+
+	// [J[ȂA܂1WuōςނȂ炻̏Ŏs
+	if (workers.empty() || count <= grainSize) {
+		fn(context, 0, count);
+		return;
+	}
+
+	const int jobCount = (count + grainSize - 1) / grainSize;
+	std::atomic<int> remaining{ jobCount };
+
+	// Wu͊eL[ɏԂɔzAŏSXbhɎd悤ɂ
+	const int self = t_queueIndex;
+	const int queueCount = (int)queues.size();
+	for (int j = 0; j < jobCount; ++j) {
+		Job job;
+		job.fn = fn;
+		job.context = context;
+		job.begin = j * grainSize;
+		job.end = (job.begin + grainSize < count) ? job.begin + grainSize : count;
+		job.remaining = &remaining;
+		queues[(self + j) % queueCount]->Push(job);
+		queuedJobs.fetch_add(1, std::memory_order_relaxed);
+	}
+	{
+		// 肩̃[J[ʒm肱ڂȂ悤ɃbNʂĂN
+		std::lock_guard<std::mutex> lock(sleepMutex);
+	}
+	wakeUp.notify_all();
+
+	// ɉASWuI܂ő҂
+	while (remaining.load(std::memory_order_acquire) > 0) {
+		if (!RunOne(self)) {
+			std::this_thread::yield();
+		}
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// [NXeB[O^̃Xbhv[
+// XbhƂɃWu̗[L[ÃL[͌납oA
+// ɂȂ瑼̃Xbh̃L[̑O瓐ށB
+// ParallelFor Ă񂾃XbhI܂ŃWûŁA
+// ParallelFor ̒ ParallelFor Ăł悢
+class JobSystem {
+public:
+	// workerCount  0 ȉȂn[hEFAXbh - 1 (ĂяõXbh̕)
+	explicit JobSystem(int workerCount = 0);
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	int WorkerCount() const { return (int)workers.size(); }
+	// ĂяõXbh܂߂
+	int ThreadCount() const { return WorkerCount() + 1; }
+
+	// [0, count)  grainSize ̃Wuɕ fn(begin, end) ɎsA
+	// SIĂ߂ (tF[YԂ̃oAƂĎg)
+	// fn ͖߂܂ŌĂяô̂wĎgȂ̂ŁARs[q[vmۂȂ
+	template<class F>
+	void ParallelFor(int count, int grainSize, const F& fn) {
+		Run(count, grainSize, &fn, [](const void* context, int begin, int end) {
+			(*static_cast<const F*>(context))(begin, end);
+		});
+	}
+
+private:
+	// Wu̖{ (context  ParallelFor ɓnꂽ֐IuWFNg)
+	using JobFunction = void (*)(const void* context, int begin, int end);
+
+	struct Job {
+		JobFunction fn;
+		const void* context;
+		int begin;
+		int end;
+		std::atomic<int>* remaining;
+	};
+
+	struct WorkQueue {
+		std::mutex mutex;
+		std::vector<Job> jobs; // 낪呤AOޑ
+		size_t head = 0;       // ܂ꂽ̐擪ʒu
+
+		void Push(const Job& job);
+		bool PopBack(Job& job);
+		bool StealFront(Job& job);
+	};
+
+	std::vector<std::thread> workers;
+	// 0 ͊OXbh (ParallelFor Ă񂾃Xbh)A1 ȍ~[J[
+	std::vector<std::unique_ptr<WorkQueue>> queues;
+
+	std::mutex sleepMutex;
+	std::condition_variable wakeUp;
+	std::atomic<int> queuedJobs{ 0 };
+	std::atomic<bool> quit{ false };
+
+	void Run(int count, int grainSize, const void* context, JobFunction fn);
+	void WorkerLoop(int queueIndex);
+	// ̃L[̃L[1oĎs (Ȃ false)
+	bool RunOne(int queueIndex);
+	static void Execute(const Job& job);
+};
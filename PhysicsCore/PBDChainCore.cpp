@@ -0,0 +1,79 @@
+#include "PBDChainCore.h"
+#include "StaticColliderSet.h"
+
+PBDChainCore::PBDChainCore(float startX, float startY, int nodeCount, float pointRadius,
+	float moveSpeed, float segmentLength)
+	:nodeCount(nodeCount), pointRadius(pointRadius), moveSpeed(moveSpeed), segmentLength(segmentLength)
+{
+	//m[h~ɔzu
+	float oneStep = (2 * PHYSICS_PI_F) / nodeCount;
+	particles.Reserve(nodeCount);
+	for (int i = 0; i < nodeCount; i++) {
+		//擪m[h͓͂œ̂ invMass  0
+		particles.Add(startX + std::cos(oneStep * i - PHYSICS_PI_F / 2) * pointRadius,
+			startY + std::sin(oneStep * i - PHYSICS_PI_F / 2) * pointRadius,
+			(i == 0) ? 0.0f : 1.0f);
+	}
+	BuildConstraints();
+}
+
+void PBDChainCore::BuildConstraints() {
+	links.Clear();
+	links.Reserve(nodeCount);
+	for (int i = 1; i <= nodeCount; i++) {
+		//p2(node0)p1(node1)ւ̃xNgdiffȂ̂ŁAp1ɑ΂Ă̓}CiXɂȂ
+		//擪m[h̎͐擪m[h𓮂Ȃ
+		if (changeVersion || i == 1) {
+			links.Add(i % nodeCount, i - 1, segmentLength, 1.0f, 0.0f);
+		}
+		else {
+			links.Add(i % nodeCount, i - 1, segmentLength, 0.5f, 0.5f);
+		}
+	}
+	builtChangeVersion = changeVersion;
+}
+
+void PBDChainCore::Update(const BodyControl& control, float dt) {
+	SetControl(control);
+	Integrate(dt);
+	SolveConstraints();
+	SolveCollisions();
+}
+
+void PBDChainCore::Integrate(float dt) {
+	float& topX = particles.x[0];
+	float& topY = particles.y[0];
+	const float step = moveSpeed * dt;
+	if (control.left) {
+		topX -= step;
+	}
+	if (control.right) {
+		topX += step;
+	}
+	if (control.up) {
+		topY -= step;
+	}
+	if (control.down) {
+		topY += step;
+	}
+}
+
+void PBDChainCore::SolveConstraints() {
+	if (changeVersion != builtChangeVersion) {
+		BuildConstraints();
+	}
+
+	// testCount Oɂ߂
+	Iterate(testCount, [this](ConstraintError* error) { UpdateNodesWithRing(error); });
+}
+
+void PBDChainCore::SolveCollisions() {
+	//ǂɂ߂荞񂾃m[h߂
+	if (staticColliders) {
+		staticColliders->ResolveParticles(particles, 0, nodeCount, collisionRadius);
+	}
+}
+
+void PBDChainCore::UpdateNodesWithRing(ConstraintError* error) {
+	links.Solve(particles, error);
+}
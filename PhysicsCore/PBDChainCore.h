@@ -0,0 +1,45 @@
+#pragma once
+#include "PhysicsMath.h"
+#include "ISoftBody.h"
+#include "DistanceConstraints.h"
+
+// 擪m[h𑀍삵Ĉ֏`F[PBDvZ (`PBDSimulation)
+class PBDChainCore : public ISoftBody {
+public:
+	//moveSpeed 1b̈ړ (pixels/s)
+	PBDChainCore(float startX, float startY, int nodeCount = 10, float pointRadius = 100,
+		float moveSpeed = 60, float segmentLength = 30);
+	//1Xebv܂Ƃ߂Đi߂ (PhysicsWorld gȂƂp)
+	void Update(const BodyControl& control, float dt = 1.0f / 60.0f);
+
+	// ISoftBody
+	void SetControl(const BodyControl& newControl) override { control = newControl; if (control.Any()) Wake(); }
+	void Integrate(float dt) override;
+	void SolveConstraints() override;
+	void SolveCollisions() override;
+	ParticleStore* GetParticles() override { return &particles; }
+	CollisionShape GetCollisionShape() const override { return { nodeCount, true, collisionRadius }; }
+	int ConstraintCount() const override { return links.Size(); }
+	int IterationLimit() const override { return testCount; }
+
+	const ParticleStore& Particles() const { return particles; }
+	int NodeCount() const { return nodeCount; }
+
+	bool changeVersion = false;
+	int testCount = 4;			//1Xebv̔񐔂̏ (΂Oɂ߂)
+	float collisionRadius = 0.0f;	//̂̕ƏՓ˂Ƃ̃m[h̔a (0 ȂՓ˂Ȃ)
+private:
+	ParticleStore particles;
+	BodyControl control;
+	int nodeCount;
+	float pointRadius;
+	float moveSpeed;
+	float segmentLength;
+
+	DistanceConstraints links;	//ׂ荇m[hm̋
+	bool builtChangeVersion = false;
+
+	//changeVersion ɍ킹Đ蒼
+	void BuildConstraints();
+	void UpdateNodesWithRing(ConstraintError* error);
+};
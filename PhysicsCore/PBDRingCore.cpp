@@ -0,0 +1,130 @@
+#include "PBDRingCore.h"
+#include "StaticColliderSet.h"
+
+PBDRingCore::PBDRingCore(float startX, float startY, int nodeCount, float pointRadius, float moveSpeed)
+	:nodeCount(nodeCount), pointRadius(pointRadius), moveSpeed(moveSpeed), segmentLength(0)
+{
+	//m[h~ɔzu
+	float oneStep = (2 * PHYSICS_PI_F) / nodeCount;
+	particles.Reserve(nodeCount + 1);
+	for (int i = 0; i < nodeCount; i++) {
+		particles.Add(startX + std::cos(oneStep * i - PHYSICS_PI_F / 2) * pointRadius,
+			startY + std::sin(oneStep * i - PHYSICS_PI_F / 2) * pointRadius);
+	}
+	//Sm[h쐬 (ł͓Ȃ̂ invMass  0)
+	particles.Add(startX, startY, 0.0f);
+
+	Vec2f diff = particles.Position(0) - particles.Position(1);
+	segmentLength = diff.length();
+	rim.SetOrder(ConstraintOrder::Coloured);
+	BuildConstraints();
+}
+
+void PBDRingCore::BuildConstraints() {
+	//changeVersion ̂Ƃ͕Б̃m[h𓮂
+	//PBD ł͏Cʂ̕zAXPBD ł͎ʂ̋t (~m[h͂ǂ 1) d݂ɂ
+	const bool xpbd = (solverMode == SolverMode::XPBD);
+	const float rate = (changeVersion || xpbd) ? 1.0f : 0.5f;
+	const float otherRate = changeVersion ? 0.0f : (xpbd ? 1.0f : 0.5f);
+
+	spokes.Clear();
+	rim.Clear();
+	spokes.Reserve(nodeCount);
+	rim.Reserve(nodeCount);
+	for (int i = 0; i < nodeCount; i++) {
+		//Sm[h͓A~̃m[h𓮂
+		spokes.Add(i, MiddleIndex(), pointRadius, rate, 0.0f, compliance);
+	}
+	for (int i = 1; i <= nodeCount; i++) {
+		rim.Add(i % nodeCount, i - 1, segmentLength, rate, otherRate, compliance);
+	}
+	builtChangeVersion = changeVersion;
+	builtSolverMode = solverMode;
+}
+
+void PBDRingCore::Update(const BodyControl& control, float dt) {
+	SetControl(control);
+	Integrate(dt);
+	SolveConstraints();
+	SolveCollisions();
+}
+
+void PBDRingCore::Integrate(float dt) {
+	float& topX = particles.x[MiddleIndex()];
+	float& topY = particles.y[MiddleIndex()];
+	const float step = moveSpeed * dt;
+	stepDt = dt;
+	if (control.left) {
+		topX -= step;
+	}
+	if (control.right) {
+		topX += step;
+	}
+	if (control.up) {
+		topY -= step;
+	}
+	if (control.down) {
+		topY += step;
+	}
+}
+
+void PBDRingCore::SolveConstraints() {
+	if (changeVersion != builtChangeVersion || solverMode != builtSolverMode) {
+		BuildConstraints();
+	}
+
+	if (solverMode == SolverMode::XPBD) {
+		//OW搔̓XebvƂ 0 ςݒ
+		spokes.SetAllCompliance(compliance);
+		rim.SetAllCompliance(compliance);
+		spokes.ResetLambdas();
+		rim.ResetLambdas();
+	}
+
+	//eړem[h̗zʒuɓ` ( testCount Oɂ߂)
+	Iterate(testCount, [this](ConstraintError* error) {
+		UpdateNodesWithRing(error);
+		UpdateNodesAround(error);
+		BarrierHit();
+	});
+}
+
+void PBDRingCore::SolveCollisions() {
+	BarrierHit();
+}
+
+void PBDRingCore::UpdateNodesWithRing(ConstraintError* error) {
+	//em[h͒Sm[hǂ܂Ȃ̂ŁASIMD ł܂Ƃ߂ĉ
+	if (solverMode == SolverMode::XPBD) {
+		spokes.SolveXPBD(particles, stepDt, error);
+	}
+	else {
+		spokes.Solve(particles, error);
+	}
+}
+
+void PBDRingCore::UpdateNodesAround(ConstraintError* error) {
+	/*
+	DQ̃|Cg̋ƂB
+	diff͂Q̃|CgԂ̃xNg܂
+	diff/D̓xNg̑傫ŊĂ̂ŒPʃxNgɂȂ
+	̒PʃxNgdiff/DɎۂɈړ(D-L)
+	L͂Q̃|Cg̗zIȋ
+	diff/D * (D-L)=diff * (D-L)/DƏ̂ŁA(D-L)/D̎KvȂ̂
+	p2(node0)p1(node1)ւ̃xNgdiffȂ̂ŁAp1ɑ΂Ă̓}CiXɂȂ
+	*/
+	//ԖځEԖځEpڂ̏ɁAFƂɂ܂Ƃ߂ĉ
+	if (solverMode == SolverMode::XPBD) {
+		rim.SolveXPBD(particles, stepDt, error);
+	}
+	else {
+		rim.Solve(particles, error);
+	}
+}
+
+void PBDRingCore::BarrierHit() {
+	//Sm[h܂߂Ă܂Ƃ߂ĉ߂
+	if (staticColliders) {
+		staticColliders->ResolveParticles(particles, 0, particles.Size(), collisionRadius);
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "PhysicsMath.h"
+#include "ISoftBody.h"
+#include "DistanceConstraints.h"
+
+// Sm[hƉ~m[hȂ郊OPBDvZ (`PBDRingSim)
+// ~m[h 0 ` nodeCount-1ASm[h͍Ō (nodeCount) Ɋi[
+class PBDRingCore : public ISoftBody {
+public:
+	//moveSpeed 1b̈ړ (pixels/s)
+	PBDRingCore(float startX, float startY, int nodeCount = 10, float pointRadius = 50, float moveSpeed = 300);
+	//1Xebv܂Ƃ߂Đi߂ (PhysicsWorld gȂƂp)
+	void Update(const BodyControl& control, float dt = 1.0f / 60.0f);
+
+	// ISoftBody
+	void SetControl(const BodyControl& newControl) override { control = newControl; if (control.Any()) Wake(); }
+	void Integrate(float dt) override;
+	void SolveConstraints() override;
+	void SolveCollisions() override;
+	ParticleStore* GetParticles() override { return &particles; }
+	//~m[hւƂďՓ˂ (Sm[h͊܂߂Ȃ)
+	CollisionShape GetCollisionShape() const override { return { nodeCount, true, collisionRadius }; }
+	int ConstraintCount() const override { return spokes.Size() + rim.Size(); }
+	int IterationLimit() const override { return testCount; }
+
+	const ParticleStore& Particles() const { return particles; }
+	int MiddleIndex() const { return nodeCount; }
+	int NodeCount() const { return nodeCount; }
+
+	//~̐ (͋ԖځEԖځEpڂ̐F)
+	void SetConstraintOrder(ConstraintOrder order) { rim.SetOrder(order); }
+	ConstraintOrder GetConstraintOrder() const { return rim.Order(); }
+
+	bool changeVersion = false;
+	int testCount = 3;			//1Xebv̔񐔂̏ (΂Oɂ߂)
+	//XPBD ɂƍd compliance Ō܂AtestCount 炵Ă_炩ȂȂ
+	SolverMode solverMode = SolverMode::PBD;
+	float compliance = 0.0f;	//XPBD ̂Ƃ̋̏_炩 (0 ȂLяk݂Ȃ)
+	float collisionRadius = 0.0f;	//̂̕ƏՓ˂Ƃ̃m[h̔a (0 ȂՓ˂Ȃ)
+private:
+	ParticleStore particles;
+	BodyControl control;
+	int nodeCount;
+	float pointRadius;			//S̔a
+	float moveSpeed;			//Sm[ḧړx (pixels/s)
+	float segmentLength;		//em[hԂ̗zIȋ
+
+	DistanceConstraints spokes;	//Sm[hƊem[h̋ (S̏d݂0)
+	DistanceConstraints rim;	//ׂ荇m[hm̋
+	bool builtChangeVersion = false;	//̏d݂Ƃ changeVersion
+	SolverMode builtSolverMode = SolverMode::PBD;
+	float stepDt = 0.0f;				//Integrate Ŏ󂯎Xebv (XPBD Ŏg)
+
+	//changeVersion  solverMode ɍ킹Đ蒼
+	void BuildConstraints();
+
+	//Sm[hƊem[h𒲐鏈
+	void UpdateNodesWithRing(ConstraintError* error);
+	//Sm[hȊÕm[h~ɂȂ悤ɋ𒲐鏈
+	void UpdateNodesAround(ConstraintError* error);
+	// (staticColliders) ɐi܂Ȃ悤ɂ鏈
+	void BarrierHit();
+};
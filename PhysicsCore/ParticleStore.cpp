@@ -0,0 +1,100 @@
+#include "ParticleStore.h"
+#include "WorldSnapshot.h"
+
+void ParticleStore::Reserve(int count) {
+	x.reserve(count); y.reserve(count);
+	px.reserve(count); py.reserve(count);
+	vx.reserve(count); vy.reserve(count);
+	invMass.reserve(count);
+	rx.reserve(count); ry.reserve(count);
+}
+
+void ParticleStore::Clear() {
+	x.clear(); y.clear();
+	px.clear(); py.clear();
+	vx.clear(); vy.clear();
+	invMass.clear();
+	rx.clear(); ry.clear();
+}
+
+int ParticleStore::Add(float posX, float posY, float inverseMass) {
+	x.push_back(posX); y.push_back(posY);
+	px.push_back(posX); py.push_back(posY);
+	vx.push_back(0.0f); vy.push_back(0.0f);
+	invMass.push_back(inverseMass);
+	rx.push_back(posX); ry.push_back(posY);
+	return Size() - 1;
+}
+
+void ParticleStore::SaveRenderState() {
+	const int n = Size();
+	const float* __restrict sx = x.data();
+	const float* __restrict sy = y.data();
+	float* __restrict dx = rx.data();
+	float* __restrict dy = ry.data();
+	for (int i = 0; i < n; ++i) {
+		dx[i] = sx[i];
+		dy[i] = sy[i];
+	}
+}
+
+void ParticleStore::SavePrevious() {
+	const int n = Size();
+	const float* __restrict sx = x.data();
+	const float* __restrict sy = y.data();
+	float* __restrict dx = px.data();
+	float* __restrict dy = py.data();
+	for (int i = 0; i < n; ++i) {
+		dx[i] = sx[i];
+		dy[i] = sy[i];
+	}
+}
+
+void ParticleStore::IntegrateGravity(float gx, float gy, float dt) {
+	const int n = Size();
+	float* __restrict posX = x.data();
+	float* __restrict posY = y.data();
+	float* __restrict velX = vx.data();
+	float* __restrict velY = vy.data();
+	const float* __restrict w = invMass.data();
+	for (int i = 0; i < n; ++i) {
+		// Œ_ (invMass == 0) ͓Ȃ
+		float movable = (w[i] > 0.0f) ? 1.0f : 0.0f;
+		velX[i] += gx * dt * movable;
+		velY[i] += gy * dt * movable;
+		posX[i] += velX[i] * dt;
+		posY[i] += velY[i] * dt;
+	}
+}
+
+void ParticleStore::UpdateVelocities(float dt, float damping) {
+	const int n = Size();
+	const float invDt = 1.0f / dt;
+	const float* __restrict posX = x.data();
+	const float* __restrict posY = y.data();
+	const float* __restrict prevX = px.data();
+	const float* __restrict prevY = py.data();
+	float* __restrict velX = vx.data();
+	float* __restrict velY = vy.data();
+	for (int i = 0; i < n; ++i) {
+		velX[i] = (posX[i] - prevX[i]) * invDt * damping;
+		velY[i] = (posY[i] - prevY[i]) * invDt * damping;
+	}
+}
+
+void ParticleStore::ClampFloor(float floorY) {
+	const int n = Size();
+	float* __restrict posY = y.data();
+	for (int i = 0; i < n; ++i) {
+		posY[i] = (posY[i] > floorY) ? floorY : posY[i];
+	}
+}
+
+void ParticleStore::WriteSnapshot(SnapshotPoint* out) const {
+	const int n = Size();
+	for (int i = 0; i < n; ++i) {
+		out[i].previous = { rx[i], ry[i] };
+		out[i].current = { x[i], y[i] };
+		out[i].velocity = { vx[i], vy[i] };
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "AlignedAllocator.h"
+#include "PhysicsMath.h"
+#include <vector>
+
+struct SnapshotPoint;
+
+// 32oCgE (AVX 1WX^) ɂ낦 float z
+using FloatArray = std::vector<float, AlignedAllocator<float, 32>>;
+
+// _ Structure of Arrays ŎRei (S\o)
+// 1̃pXŐĜ1`2Ȃ̂ŁAƂɕʔzɂĂ
+// LbVC𖳑ʂɂA[v̂܂܃xNgł
+class ParticleStore {
+public:
+	FloatArray x, y;       // ݂(\)ʒu
+	FloatArray px, py;     // 1ÕXebv̈ʒu (xvZ̊)
+	FloatArray vx, vy;     // x
+	FloatArray invMass;    // ʂ̋t (0 ȂŒ_)
+	FloatArray rx, ry;     // `ԗp: Ō̃Xebvn߂Öʒu
+
+	void Reserve(int count);
+	void Clear();
+	// _ǉẴCfbNXԂ
+	int Add(float posX, float posY, float inverseMass = 1.0f);
+	int Size() const { return (int)x.size(); }
+
+	Vec2f Position(int i) const { return { x[i], y[i] }; }
+	void SetPosition(int i, const Vec2f& p) { x[i] = p.x; y[i] = p.y; }
+	// Ō̃Xebv̑Öʒu alpha (0`1) ŕԂ`p̈ʒu
+	Vec2f Interpolated(int i, float alpha) const {
+		return { rx[i] + (x[i] - rx[i]) * alpha, ry[i] + (y[i] - ry[i]) * alpha };
+	}
+
+	// --- Xebv (ǂAXg[~O[v) ---
+	// ݈ʒu`ԗp rx, ry ɕۑ (Xebv̍ŏɌĂ)
+	void SaveRenderState();
+	// `ԗp̈ʒu (rx, ry)A݈ʒuAx out[0`Size-1] ɃRs[
+	void WriteSnapshot(SnapshotPoint* out) const;
+	// ݈ʒu px, py ɕۑ
+	void SavePrevious();
+	// xɉxA\ʒui߂ (v += g*dt, x += v*dt)
+	void IntegrateGravity(float gx, float gy, float dt);
+	// C̈ʒu瑬xČvZ (v = (x - px) / dt * damping)
+	void UpdateVelocities(float dt, float damping);
+	// w肵Y艺ɂ߂荞񂾎_߂
+	void ClampFloor(float floorY);
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <cmath>
+
+// DxLibɈˑȂ~ (DX_PI_F Ɠl)
+constexpr float PHYSICS_PI_F = 3.141592654f;
+
+// 2xNg/W\
+struct Vec2f {
+	float x;
+	float y;
+
+	// Iy[^[I[o[[h (vZȗ)
+	Vec2f operator+(const Vec2f& other) const { return { x + other.x, y + other.y }; }
+	Vec2f operator-(const Vec2f& other) const { return { x - other.x, y - other.y }; }
+	Vec2f operator*(float scalar) const { return { x * scalar, y * scalar }; }
+
+	// XJ[Z (ʂdt̋tŊۂɕ֗)
+	Vec2f operator/(float scalar) const {
+		float inv_s = 1.0f / scalar;
+		return { x * inv_s, y * inv_s };
+	}
+
+	// Zq (p += dp; ̂悤Ɏg)
+	Vec2f& operator+=(const Vec2f& other) { x += other.x; y += other.y; return *this; }
+
+	// Iy[^[I[o[[h (xNg̒)
+	float lengthSq() const { return x * x + y * y; }
+	float length() const { return std::sqrt(lengthSq()); }
+
+	// K (PʃxNg߂B̖@̌vZɕK{)
+	Vec2f normalize() const {
+		float len = length();
+		return (len > 0) ? *this / len : Vec2f{ 0.0f, 0.0f };
+	}
+};
+
+// PopRingManagerŎgĂO
+using Vec2F = Vec2f;
@@ -0,0 +1,370 @@
+#include "PhysicsWorld.h"
+#include "Profiler.h"
+#include "SimdSupport.h"
+#include <algorithm>
+#include <cmath>
+
+PhysicsWorld::PhysicsWorld(int workerCount)
+	:jobs(workerCount)
+{
+	// ߃Zbg̔[J[Oɍς܂Ă
+	GetSimdLevel();
+}
+
+void PhysicsWorld::RemoveBody(ISoftBody* body) {
+	for (size_t i = 0; i < bodies.size(); ++i) {
+		if (bodies[i].get() == body) {
+			// xȂȂ̂ŁA≡ŖĂ̂N
+			for (const std::unique_ptr<ISoftBody>& other : bodies) {
+				if (other->IsSleeping() && BoundsOverlap(other->sleepState, body->sleepState)) other->Wake();
+			}
+			bodies.erase(bodies.begin() + i);
+			return;
+		}
+	}
+}
+
+void PhysicsWorld::Clear() {
+	bodies.clear();
+	stepCount = 0;
+	activeCount = 0;
+	solveStats = SolverStats();
+}
+
+void PhysicsWorld::SetSleepSettings(const SleepSettings& settings) {
+	sleep = settings;
+	if (!sleep.enabled) WakeAll();
+}
+
+void PhysicsWorld::WakeAll() {
+	for (const std::unique_ptr<ISoftBody>& body : bodies) body->Wake();
+}
+
+int PhysicsWorld::SleepingBodyCount() const {
+	int count = 0;
+	for (const std::unique_ptr<ISoftBody>& body : bodies) {
+		if (body->IsSleeping()) ++count;
+	}
+	return count;
+}
+
+void PhysicsWorld::PublishSnapshot() {
+	PROFILE_SCOPE("PublishSnapshot");
+	WorldSnapshot& snapshot = snapshots.BeginWrite();
+	snapshot.Reset(stepCount, Profiler::Now());
+	for (const std::unique_ptr<ISoftBody>& body : bodies) {
+		const int count = body->RenderPointCount();
+		body->WriteRenderPoints(snapshot.AddBody(body.get(), count));
+	}
+	snapshots.Publish();
+}
+
+uint32_t PhysicsWorld::StateHash() const {
+	// FNV-1a ̏lÂƂ̏Ԃǉɍ
+	uint32_t hash = 2166136261u;
+	for (const std::unique_ptr<ISoftBody>& body : bodies) {
+		hash = body->HashState(hash);
+	}
+	return hash;
+}
+
+int PhysicsWorld::GrainSize(int count) const {
+	// Xbh4Wu炢ɕāAd̂΂Ăݍ悤ɂ
+	const int jobsPerThread = 4;
+	int grain = count / (jobs.ThreadCount() * jobsPerThread);
+	return (grain < 1) ? 1 : grain;
+}
+
+void PhysicsWorld::UpdateBounds(ISoftBody& body, float margin) {
+	BodySleepState& state = body.sleepState;
+	state.minX = state.minY = 0.0f;
+	state.maxX = state.maxY = -1.0f;
+	const ParticleStore* particles = body.GetParticles();
+	const CollisionShape shape = body.GetCollisionShape();
+	if (particles == nullptr || shape.radius <= 0.0f) return;
+	const int count = std::min(shape.nodeCount, particles->Size());
+	if (count == 0) return;
+
+	float minX = particles->x[0], maxX = minX;
+	float minY = particles->y[0], maxY = minY;
+	for (int i = 1; i < count; ++i) {
+		minX = std::min(minX, particles->x[i]);
+		maxX = std::max(maxX, particles->x[i]);
+		minY = std::min(minY, particles->y[i]);
+		maxY = std::max(maxY, particles->y[i]);
+	}
+	const float pad = shape.radius + margin;
+	state.minX = minX - pad;
+	state.minY = minY - pad;
+	state.maxX = maxX + pad;
+	state.maxY = maxY + pad;
+}
+
+bool PhysicsWorld::BoundsOverlap(const BodySleepState& a, const BodySleepState& b) {
+	// ̋` (max < min) ͂ǂƂdȂȂ
+	if (a.maxX < a.minX || b.maxX < b.minX) return false;
+	return a.minX <= b.maxX && b.minX <= a.maxX && a.minY <= b.maxY && b.minY <= a.maxY;
+}
+
+int PhysicsWorld::CollectActiveBodies(ISoftBody** out) {
+	const int count = BodyCount();
+	int active = 0;
+	for (int i = 0; i < count; ++i) {
+		if (!bodies[i]->IsSleeping()) out[active++] = bodies[i].get();
+	}
+	if (active == count) return active;
+
+	PROFILE_SCOPE("WakeNearby");
+	// NĂ镨̂́AÕXebvœōL (̃Xebvł܂œ͂)
+	for (int i = 0; i < active; ++i) {
+		UpdateBounds(*out[i], out[i]->sleepState.motion * 2.0f);
+	}
+	// N̂т̌ɑĒג̂ŁAdȂĖĂ镨̂͂܂Ƃ߂ċN
+	// (ׂ̂ NĂ镨 ~ Ă镨 ̋`̑gŁA_ɂ͐GȂ)
+	for (int i = 0; i < active; ++i) {
+		const BodySleepState& awake = out[i]->sleepState;
+		for (int j = 0; j < count; ++j) {
+			ISoftBody* other = bodies[j].get();
+			if (!other->IsSleeping() || !BoundsOverlap(awake, other->sleepState)) continue;
+			other->Wake();
+			out[active++] = other;
+		}
+	}
+	return active;
+}
+
+void PhysicsWorld::FindContactIslands(ISoftBody* const* list, int count, ContactIslands& islands, FrameArena& arena) const {
+	int* parent = islands.islandOf;
+	for (int i = 0; i < count; ++i) parent[i] = i;
+	auto find = [parent](int i) {
+		while (parent[i] != i) {
+			parent[i] = parent[parent[i]];
+			i = parent[i];
+		}
+		return i;
+	};
+
+	// `̍[̏ɕׁA[̉E[Oɂ镨̂Ƃׂ (sweep and prune)
+	int* order = arena.AllocateArray<int>(count);
+	int sorted = 0;
+	for (int i = 0; i < count; ++i) {
+		const BodySleepState& state = list[i]->sleepState;
+		if (state.minX <= state.maxX) order[sorted++] = i;
+	}
+	std::sort(order, order + sorted, [list](int a, int b) { return list[a]->sleepState.minX < list[b]->sleepState.minX; });
+	for (int k = 0; k < sorted; ++k) {
+		const BodySleepState& a = list[order[k]]->sleepState;
+		for (int m = k + 1; m < sorted && list[order[m]]->sleepState.minX <= a.maxX; ++m) {
+			if (!BoundsOverlap(a, list[order[m]]->sleepState)) continue;
+			// ԍ̏\ɂ (͂Ȃ疈񓯂̔ԍƕтɂȂ)
+			const int rootA = find(order[k]);
+			const int rootB = find(order[m]);
+			if (rootA < rootB) parent[rootB] = rootA;
+			else if (rootB < rootA) parent[rootA] = rootB;
+		}
+	}
+
+	// 2ȏ̂̕܂ޓA\̔ԍ̏ members ɋl߂
+	int* size = arena.AllocateArray<int>(count);
+	int* cursor = arena.AllocateArray<int>(count);
+	for (int i = 0; i < count; ++i) size[i] = 0;
+	for (int i = 0; i < count; ++i) {
+		islands.islandOf[i] = find(i);
+		++size[islands.islandOf[i]];
+	}
+	islands.count = 0;
+	int total = 0;
+	for (int root = 0; root < count; ++root) {
+		if (islands.islandOf[root] != root || size[root] < 2) continue;
+		cursor[root] = total;
+		islands.start[islands.count++] = total;
+		total += size[root];
+	}
+	islands.start[islands.count] = total;
+	for (int i = 0; i < count; ++i) {
+		const int root = islands.islandOf[i];
+		if (size[root] >= 2) islands.members[cursor[root]++] = list[i];
+	}
+}
+
+void PhysicsWorld::MeasureRest(ISoftBody& body, float dt) const {
+	BodySleepState& state = body.sleepState;
+	const ParticleStore* particles = body.CanSleep() ? body.GetParticles() : nullptr;
+	const int count = particles ? particles->Size() : 0;
+	if (count == 0) {
+		state.restTime = 0.0f;
+		return;
+	}
+
+	float energy = 0.0f;
+	int movable = 0;
+	float centerX = 0.0f, centerY = 0.0f;
+	float motion = 0.0f;
+	for (int i = 0; i < count; ++i) {
+		centerX += particles->x[i];
+		centerY += particles->y[i];
+		// Xebv̍ŏ (SaveRenderState) ̈ړBxȂ (œ_) Ō
+		motion = std::max(motion, std::max(std::fabs(particles->x[i] - particles->rx[i]), std::fabs(particles->y[i] - particles->ry[i])));
+		if (particles->invMass[i] == 0.0f) continue;
+		energy += 0.5f * (particles->vx[i] * particles->vx[i] + particles->vy[i] * particles->vy[i]);
+		++movable;
+	}
+	if (movable > 0) energy /= movable;
+	centerX /= count;
+	centerY /= count;
+	state.motion = motion;
+
+	// ÂɂȂn߂ʒû (1Xebv͏ĂA葱ĂȂ疰点Ȃ)
+	if (state.restTime == 0.0f) {
+		state.anchorX = centerX;
+		state.anchorY = centerY;
+	}
+	const float driftX = centerX - state.anchorX;
+	const float driftY = centerY - state.anchorY;
+	const bool quiet = energy < sleep.energy && driftX * driftX + driftY * driftY < sleep.drift * sleep.drift;
+	state.restTime = quiet ? state.restTime + dt : 0.0f;
+}
+
+void PhysicsWorld::PutToSleep(ISoftBody& body) {
+	BodySleepState& state = body.sleepState;
+	state.sleeping = true;
+	state.motion = 0.0f;
+	// ̈ʒuŎ~߂ (`̕ԂɋNƂ̑x 0 n܂)
+	ParticleStore* particles = body.GetParticles();
+	particles->SaveRenderState();
+	particles->SavePrevious();
+	std::fill(particles->vx.begin(), particles->vx.end(), 0.0f);
+	std::fill(particles->vy.begin(), particles->vy.end(), 0.0f);
+	UpdateBounds(body, 0.0f);
+}
+
+void PhysicsWorld::UpdateSleep(ISoftBody** list, int count, const int* islandOf, float dt, FrameArena& arena) {
+	PROFILE_SCOPE("Sleep");
+	// ̂Ƃ̐Â͎̏ԂɂȂ̂ŕɑ
+	jobs.ParallelFor(count, GrainSize(count), [this, list, dt](int begin, int end) {
+		for (int i = begin; i < end; ++i) MeasureRest(*list[i], dt);
+	});
+	// GꍇĂ镨̂1ł܂Ă΁A̓͂܂Ƃ߂ċNĂ
+	// (̂̕ƁAɍڂ̂xڐGȂȂ)
+	bool* islandAwake = arena.AllocateArray<bool>(count);
+	for (int i = 0; i < count; ++i) islandAwake[i] = false;
+	for (int i = 0; i < count; ++i) {
+		const BodySleepState& state = list[i]->sleepState;
+		if (state.restTime < sleep.time) islandAwake[islandOf[i]] = true;
+	}
+	for (int i = 0; i < count; ++i) {
+		if (!islandAwake[islandOf[i]]) PutToSleep(*list[i]);
+	}
+}
+
+void PhysicsWorld::GatherSolveStats(ISoftBody* const* list, int count) {
+	solveStats = SolverStats();
+	float sumSq = 0.0f;
+	for (int i = 0; i < count; ++i) {
+		const SolverStats& body = list[i]->LastSolveStats();
+		solveStats.iterations += body.iterations;
+		solveStats.timedOut += body.timedOut;
+		solveStats.maxError = std::max(solveStats.maxError, body.maxError);
+		sumSq += body.rmsError * body.rmsError;
+	}
+	solveStats.rmsError = (count > 0) ? std::sqrt(sumSq / count) : 0.0f;
+
+	// ͕1ETuXebv1񂠂̕ςɂċL^
+	PROFILE_COUNTER("Solver.Iterations", (count > 0) ? (float)solveStats.iterations / (count * subSteps) : 0.0f);
+	PROFILE_COUNTER("Solver.MaxError", solveStats.maxError);
+	PROFILE_COUNTER("Solver.RmsError", solveStats.rmsError);
+	PROFILE_COUNTER("Solver.TimedOut", solveStats.timedOut);
+	PROFILE_COUNTER("Bodies.Active", count);
+}
+
+void PhysicsWorld::Step(float dt, const FrameContext& frame) {
+	PROFILE_SCOPE("PhysicsWorld::Step");
+	stepCount++;
+	activeCount = 0;
+	solveStats = SolverStats();
+	const int count = BodyCount();
+	if (count == 0) return;
+	FrameArena* arena = frame.arena;
+	if (arena == nullptr) {
+		stepArena.Reset();
+		arena = &stepArena;
+	}
+	// 蔻ǉ́Âǂݎn߂O BVH Ă
+	// (蔻肪ςƎxȂȂ邩Ȃ̂ŁAĂ̂N)
+	if (statics.NeedsBuild()) {
+		statics.Build();
+		WakeAll();
+	}
+	// ̃Xebvœ (NĂ) ̂̐|C^̕сBĂ镨̂͂ǂ̃tF[YɂnȂ
+	ISoftBody** list = arena->AllocateArray<ISoftBody*>(count);
+	const int active = CollectActiveBodies(list);
+	activeCount = active;
+	if (active == 0) return;
+	const int grain = GrainSize(active);
+	const float subDt = dt / subSteps;
+	// ̑ł؂ (Ԃ̗\Z͂̃Xebv̎n܂肩琔)
+	convergence.tolerance = solver.tolerance;
+	convergence.minIterations = solver.minIterations;
+	convergence.deadline = (solver.budgetMs > 0.0f) ? Profiler::Now() + (int64_t)(solver.budgetMs * 1e6f) : 0;
+	// ̔z̓TuXebvƂɍ蒼 (Ō̃TuXebv̓Ŗ点)
+	ContactIslands islands;
+	islands.islandOf = arena->AllocateArray<int>(active);
+	islands.members = arena->AllocateArray<ISoftBody*>(active);
+	islands.start = arena->AllocateArray<int>(active + 1);
+	const int selfIterations = contactIterations;
+
+	for (int sub = 0; sub < subSteps; ++sub) {
+		const bool first = (sub == 0);
+		{
+			PROFILE_SCOPE("Integrate");
+			jobs.ParallelFor(active, grain, [list, subDt, first](int begin, int end) {
+				for (int i = begin; i < end; ++i) {
+					if (first) {
+						list[i]->SaveRenderState();
+						list[i]->ResetSolveStats();
+					}
+					list[i]->Integrate(subDt);
+				}
+			});
+		}
+		{
+			PROFILE_SCOPE("SolveConstraints");
+			jobs.ParallelFor(active, grain, [list](int begin, int end) {
+				for (int i = begin; i < end; ++i) list[i]->SolveConstraints();
+			});
+		}
+		{
+			PROFILE_SCOPE("SolveCollisions");
+			jobs.ParallelFor(active, grain, [list, arena, selfIterations](int begin, int end) {
+				for (int i = begin; i < end; ++i) {
+					list[i]->SolveCollisions();
+					// gƂ̐ڐG͑̂̕ɐGȂ̂ŁAŕ̂Ƃɉ
+					ContactSolver::SolveSelf(*list[i], selfIterations, *arena);
+					// ̓m̐ڐG̓߂邽߂̕܋`
+					UpdateBounds(*list[i], 0.0f);
+				}
+			});
+		}
+		{
+			PROFILE_SCOPE("Contacts");
+			FindContactIslands(list, active, islands, *arena);
+			if ((int)islandSolvers.size() < islands.count) islandSolvers.resize(islands.count);
+			// ǂ͓̂܂܂Ȃ̂ŁAƂɕʁX̃\o[ŕɉ
+			jobs.ParallelFor(islands.count, 1, [this, &islands, arena](int begin, int end) {
+				for (int k = begin; k < end; ++k) {
+					ContactSolver& islandSolver = islandSolvers[k];
+					islandSolver.SetIterations(contactIterations);
+					islandSolver.Solve(islands.members + islands.start[k], islands.start[k + 1] - islands.start[k], *arena);
+				}
+			});
+		}
+		{
+			PROFILE_SCOPE("UpdateVelocities");
+			jobs.ParallelFor(active, grain, [list, subDt](int begin, int end) {
+				for (int i = begin; i < end; ++i) list[i]->UpdateVelocities(subDt);
+			});
+		}
+	}
+	GatherSolveStats(list, active);
+	if (sleep.enabled) UpdateSleep(list, active, islands.islandOf, dt, *arena);
+}
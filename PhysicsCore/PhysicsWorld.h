@@ -0,0 +1,147 @@
+#pragma once
+#include "ContactSolver.h"
+#include "FrameArena.h"
+#include "ISoftBody.h"
+#include "JobSystem.h"
+#include "StaticColliderSet.h"
+#include "WorldSnapshot.h"
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// ̂̕AJobSystem ŕ1Xebvi߂郏[h
+// Step  ϕ    Փ  ̓m̏Փ  xXV ̏ɃtF[Yi߁A
+// etF[Y͑Ŝ̕IĂ玟ɐiށB
+// dt ͌ŒXebvnz (GameManager `t[Ƃ͕ʂɉ񐔂߂)
+//
+// ̓m̏Փ˂́A܋`dȂĂ镨̂̂܂Ƃ܂ () Ƃɕɉ
+// (̎g̐ڐĜ͕Ƃ̏Փ˃tF[Yŉ)B
+//
+// ΂炭~܂Ă镨͖̂点ANĂ镨̂tF[YɓnB
+// ̂́̕AS~܂Ă܂Ƃ߂Ė点
+class PhysicsWorld {
+public:
+	// ̂𖰂点 (l艺 time b疰点)
+	struct SleepSettings {
+		bool enabled = true;
+		float energy = 8.0f;	// 鎿_́Aʂ̉^GlM[ 1/2 v^2 ̕ (4 px/s ̑)
+		float drift = 2.0f;		// ÂɂȂn߂Ă̏dŜ (pxB芊Ă̂𖰂点Ȃ)
+		float time = 0.5f;
+	};
+
+	// ̂̐̑ł؂
+	struct SolverSettings {
+		float tolerance = 0.01f;	// ̈ᔽ̍ő (px) ȉɂȂÂ̔񐔂Oɂ߂ (0 Ȃł؂Ȃ)
+		int minIterations = 1;		// K񂷉
+		// 1 Step ŔɎgĂ悢 (msB0 Ȃ琧Ȃ)
+		// ̂ minIterations ł߂̂ŁAdƂ͏_炩ȂĎԂтȂ
+		// (ԂŌʂς̂ŁAvCœʂɂƂ 0 ɂ邱)
+		float budgetMs = 0.0f;
+	};
+
+	// workerCount  JobSystem ɂ̂܂ܓn (0 ȉȂn[hEFAɍ킹)
+	explicit PhysicsWorld(int workerCount = 0);
+
+	// ̂ă[hɎ (߂l̓[hj܂ŗL)
+	template<class T, class... Args>
+	T* CreateBody(Args&&... args) {
+		std::unique_ptr<T> body = std::make_unique<T>(std::forward<Args>(args)...);
+		T* raw = body.get();
+		raw->SetStaticColliders(&statics);
+		raw->SetConvergence(&convergence);
+		bodies.push_back(std::move(body));
+		return raw;
+	}
+	// 菜̂ɐGĂ (߂ŖĂ) ̂͋N
+	void RemoveBody(ISoftBody* body);
+	// ׂ̂Ď菜AXebv̉񐔂ƏWvŏɖ߂
+	// (ÓIȓ蔻EݒE[J[̃Xbh͎cB蒼Ɏg񂷂ƂɌĂ)
+	void Clear();
+
+	int BodyCount() const { return (int)bodies.size(); }
+	ISoftBody* Body(int i) { return bodies[i].get(); }
+
+	// dt  subSteps ɕĐi߂ (`ԗp̏Ԃ͍ŏ̃TuXebv̑Oɕۑ)
+	// Xebv̍Ɨp̔z frame.arena ؂oB
+	// arena nȂƂ (x`Ȃ) ̓[h̂XebvƂɋ󂯂Ďg
+	void Step(float dt, const FrameContext& frame = FrameContext());
+
+	// XPBD ̂́̕A񐔂𑝂₷TuXebv𑝂₷dƈ萫
+	void SetSubSteps(int count) { subSteps = (count < 1) ? 1 : count; }
+	int SubSteps() const { return subSteps; }
+
+	void SetSolverSettings(const SolverSettings& settings) { solver = settings; }
+	const SolverSettings& GetSolverSettings() const { return solver; }
+	// O Step ŋNĂ̂̔̍vƁAᔽ̍őE敽ϕ (rmsError ͕̂Ƃ̒l̓敽)
+	// Profiler ɂ "Solver.*" ̃JE^ƂċL^
+	const SolverStats& LastSolveStats() const { return solveStats; }
+
+	// 点 (enabled  false ɂƑŜNAȌ͖点Ȃ)
+	void SetSleepSettings(const SleepSettings& settings);
+	const SleepSettings& GetSleepSettings() const { return sleep; }
+	// ŜN (̂̈ʒuO珑ƂȂ)
+	void WakeAll();
+	// O Step œ̂̐ƁAܖĂ镨̂̐
+	int ActiveBodyCount() const { return activeCount; }
+	int SleepingBodyCount() const;
+
+	// Ŝ̕`p̓_Rs[āA`摤猩悤ɂ (Step ƓXbhĂ)
+	void PublishSnapshot();
+	// Ō PublishSnapshot  (`摤1XbhĂԁBStep ƓɌĂł悢)
+	// ߂l͎ LatestSnapshot ĂԂ܂ŏȂ
+	const WorldSnapshot& LatestSnapshot() { return snapshots.Latest(); }
+	// ܂ł Step 
+	uint64_t StepCount() const { return stepCount; }
+
+	// Ŝ̈ʒuƑx̃rbg񂩂nbV (vCœʂɂȂ̊mFp)
+	// ê ISoftBody::HashState ɍ (_Ȃol܂)
+	uint32_t StateHash() const;
+
+	JobSystem& Jobs() { return jobs; }
+	// ̓mƕ̎g̐ڐG (GetCollisionShape ̔a 0 łȂ̂ΏہBdȂ肪[Ƃ͑₷)
+	void SetContactIterations(int count) { contactIterations = (count < 1) ? 1 : count; }
+	int ContactIterations() const { return contactIterations; }
+	// x̐ÓIȓ蔻 (ǉ̍ŏ Step  BVH )
+	StaticColliderSet& Statics() { return statics; }
+
+private:
+	// ܋`dȂĂ镨̂̂܂Ƃ܂ ()BʁX̂̐̕ڐG͓̒łNȂ
+	struct ContactIslands {
+		int* islandOf = nullptr;		// NĂ镨̂̕т̔ԍ  ̑\̔ԍ (dȂ镨̂ȂΎ)
+		ISoftBody** members = nullptr;	// 2ȏ̂̕܂ޓ̂̕AƂɑĕׂ
+		int* start = nullptr;			//  k ̂̕ members[start[k]] ` members[start[k + 1] - 1]
+		int count = 0;					// 2ȏ̂̕܂ޓ̐
+	};
+
+	std::vector<std::unique_ptr<ISoftBody>> bodies;
+	JobSystem jobs;
+	FrameArena stepArena{ 64 * 1024 };	// FrameContext ɃA[iȂƂ̑
+	std::vector<ContactSolver> islandSolvers;	// Ƃ̃\o[ (̔ԍɎg)
+	int contactIterations = 1;
+	StaticColliderSet statics;
+	int subSteps = 1;
+	uint64_t stepCount = 0;
+	SnapshotBuffer snapshots;
+	SleepSettings sleep;
+	int activeCount = 0;
+	SolverSettings solver;
+	ConvergenceSettings convergence;	// solver AŜǂ (Step ̊Ԃ͏Ȃ)
+	SolverStats solveStats;
+
+	// 1Wu̐̕ (Wu̎󂯓ñRXgڗȂxɂ܂Ƃ߂)
+	int GrainSize(int count) const;
+	// NĂ镨̂ out ɕׁA̋߂ŖĂ镨̂NČɑBׂԂ
+	int CollectActiveBodies(ISoftBody** out);
+	// ̂ sleepState ̕܋`瓇߂ (z͌Ăяo count  (start  count + 1 ) pӂ)
+	void FindContactIslands(ISoftBody* const* list, int count, ContactIslands& islands, FrameArena& arena) const;
+	// Xebv̌ɁÂ~܂Ă邩𒲂ׁA~܂𖰂点
+	void UpdateSleep(ISoftBody** list, int count, const int* islandOf, float dt, FrameArena& arena);
+	void MeasureRest(ISoftBody& body, float dt) const;
+	static void PutToSleep(ISoftBody& body);
+	// Փ˂̔a margin L܋` sleepState ɏ (Փ˂Ȃ̂͋ɂ)
+	static void UpdateBounds(ISoftBody& body, float margin);
+	static bool BoundsOverlap(const BodySleepState& a, const BodySleepState& b);
+	// NĂ̂̔̌ʂ܂Ƃ߂āAProfiler ɋL^
+	void GatherSolveStats(ISoftBody* const* list, int count);
+};
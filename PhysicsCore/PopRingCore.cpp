@@ -0,0 +1,191 @@
+#include "PopRingCore.h"
+#include "StaticColliderSet.h"
+
+PopRingCore::PopRingCore(int num, float r, Vec2F center_pos) :
+	numNodes(num), initialRadius(r), center(center_pos),
+	dampingFactor(0.995f), distanceStiffness(0.5f) // 0.0`1.0
+{
+	// m[h̏zu
+	particles.Reserve(numNodes);
+	for (int i = 0; i < numNodes; ++i) {
+		float angle = 2.0f * PHYSICS_PI_F * (float)i / (float)numNodes;
+		Vec2F pos = center + Vec2F{ initialRadius * std::cos(angle), initialRadius * std::sin(angle) };
+
+		// ʂ1.0 (invMass1.0ɂȂ)Ax0
+		particles.Add(pos.x, pos.y, 1.0f);
+	}
+	// אڃm[hԂ̏vZ
+	initialSegmentLength = (particles.Position(0) - particles.Position(1)).length();
+
+	// ʐϐ̊ (zu̖ʐ)
+	gradX.resize(numNodes);
+	gradY.resize(numNodes);
+	restArea = CurrentArea();
+
+	//  (ID  i)
+	edges.Reserve(numNodes);
+	edges.SetOrder(ConstraintOrder::Coloured);
+	for (int i = 0; i < numNodes; ++i) {
+		edges.Add(i, (i + 1) % numNodes, initialSegmentLength, 0.0f, 0.0f); // OȂ̂Ŏ̃m[h͏z
+	}
+	ApplyEdgeWeights();
+}
+
+void PopRingCore::ApplyEdgeWeights() {
+	const float* w = particles.invMass.data();
+	for (int i = 0; i < numNodes; ++i) {
+		const int i1 = i;
+		const int i2 = (i + 1) % numNodes;
+		if (solverMode == SolverMode::XPBD) {
+			// XPBD: [ʂ̋tœ (d compliance Ō܂)
+			edges.SetWeights(i, w[i1], w[i2]);
+		}
+		else {
+			// PBD: lambda = -C / (w1 + w2) * stiffness, dp1 = n * lambda * w1, dp2 = -n * lambda * w2
+			// (p1 𓮂ƁAǂ̕ӂɈ̂ŃO葱ĔU)
+			float W = w[i1] + w[i2]; // 
+			float weight1 = (W == 0.0f) ? 0.0f : distanceStiffness * w[i1] / W;
+			float weight2 = (W == 0.0f) ? 0.0f : distanceStiffness * w[i2] / W;
+			edges.SetWeights(i, weight1, weight2);
+		}
+	}
+}
+
+void PopRingCore::SetSolverMode(SolverMode mode, float compliance) {
+	solverMode = mode;
+	edges.SetAllCompliance(compliance);
+	ApplyEdgeWeights();
+}
+
+void PopRingCore::Update(float dt) {
+	// PBD͒ʏAŒ^CXebvŎs (dt ͌ĂяǒŒXebv)
+	// 1. O͂̓KpƗ\ʒǔvZ
+	Integrate(dt);
+
+	// 2. ̔Iȉ
+	SolveConstraints();
+	SolveCollisions();
+
+	// 3. ŏIʒuƑx̍XV
+	UpdateVelocities(dt);
+}
+
+void PopRingCore::SolveConstraints() {
+	// XPBD ̃OW搔̓XebvƂ 0 ςݒ
+	if (solverMode == SolverMode::XPBD) {
+		edges.ResetLambdas();
+		areaLambda = 0.0f;
+	}
+	// Ɩʐς̂ꂪ\Ȃ iterations Oɂ߂
+	Iterate(iterations, [this](ConstraintError* error) {
+		SolveDistanceConstraints(error);
+		SolveAreaConstraint(error); // (ʐψێ)
+		ApplyCollisionConstraint(); // (ǂƂ̏Փ)
+	});
+}
+
+// ------------------------------------------------------------------------
+// PBD Xebv 1: O͂̓KpƗ\ʒǔvZ
+// ------------------------------------------------------------------------
+void PopRingCore::ApplyExternalForces(float dt) {
+	// ݂̈ʒuۑ (previousPosition)
+	particles.SavePrevious();
+
+	// xɏd͂Kp (Eulerϕ) A\ʒuvZ (xňړ)
+	particles.IntegrateGravity(GRAVITY.x, GRAVITY.y, dt);
+}
+
+// ------------------------------------------------------------------------
+// PBD Xebv 2.1:  (Ǒ`ƒe͐ێ)
+// ------------------------------------------------------------------------
+void PopRingCore::SolveDistanceConstraints(ConstraintError* error) {
+	// SĂ̗אڃm[hyAɑ΂ĐKp
+	// FƂɂ܂Ƃ߂ĉ (F͓̐_LȂ̂ SIMD ł܂Ƃ߂ĉ)
+	if (solverMode == SolverMode::XPBD) {
+		edges.SolveXPBD(particles, stepDt, error);
+	}
+	else {
+		edges.Solve(particles, error);
+	}
+}
+
+// ------------------------------------------------------------------------
+// PBD Xebv 2.2: ʐϐ (O̖ʐςڕWʐςɕۂ)
+// ------------------------------------------------------------------------
+// CЂŕtʐ A = 1/2 *  (x_i * y_{i+1} - x_{i+1} * y_i) ߁A
+// C = A - restArea * pressure  0 ɂB
+// m[h i ɂĂ̌z (dA/dx_i, dA/dy_i) = 1/2 * (y_{i+1} - y_{i-1}, x_{i-1} - x_{i+1}) ŁA
+// ʐρEzE  w_i |grad_i|^2 1̃[vł܂Ƃ߂ċ߂ĂAem[hzɓB
+// ̐Ȃ̂ŁAׂꂽƂ͖c܂Ac݂Ƃ͏k߂B
+float PopRingCore::CurrentArea() const {
+	const float* x = particles.x.data();
+	const float* y = particles.y.data();
+	float area = 0.0f;
+	for (int i = 0; i < numNodes; ++i) {
+		const int next = (i + 1 == numNodes) ? 0 : i + 1;
+		area += x[i] * y[next] - x[next] * y[i];
+	}
+	return area * 0.5f;
+}
+
+void PopRingCore::SolveAreaConstraint(ConstraintError* error) {
+	float* x = particles.x.data();
+	float* y = particles.y.data();
+	const float* w = particles.invMass.data();
+	float* gx = gradX.data();
+	float* gy = gradY.data();
+
+	// ʐρEzE1pXŋ߂
+	float area = 0.0f;
+	float denom = 0.0f;
+	for (int i = 0; i < numNodes; ++i) {
+		const int prev = (i == 0) ? numNodes - 1 : i - 1;
+		const int next = (i + 1 == numNodes) ? 0 : i + 1;
+		area += x[i] * y[next] - x[next] * y[i];
+		gx[i] = 0.5f * (y[next] - y[prev]);
+		gy[i] = 0.5f * (x[prev] - x[next]);
+		denom += w[i] * (gx[i] * gx[i] + gy[i] * gy[i]);
+	}
+	area *= 0.5f;
+
+	float C = area - restArea * pressure;
+	// ʐς̂́A̒ŊĔâ (px) ɒĂ狗̈ᔽƍ
+	if (error) error->Add(C / (initialSegmentLength * numNodes));
+	float s;
+	if (solverMode == SolverMode::XPBD) {
+		float alpha = (stepDt > 0.0f) ? areaCompliance / (stepDt * stepDt) : 0.0f;
+		if (denom + alpha <= 0.0f) return;
+		float deltaLambda = (-C - alpha * areaLambda) / (denom + alpha);
+		areaLambda += deltaLambda;
+		s = deltaLambda;
+	}
+	else {
+		if (denom <= 0.0f) return;
+		s = -C / denom * areaStiffness;
+	}
+
+	// em[hʂ̋tɉČzɓ
+	for (int i = 0; i < numNodes; ++i) {
+		x[i] += s * w[i] * gx[i];
+		y[i] += s * w[i] * gy[i];
+	}
+}
+
+// ------------------------------------------------------------------------
+// PBD Xebv 2.3: Փː (ǂƂ̏Փ)
+// ------------------------------------------------------------------------
+void PopRingCore::ApplyCollisionConstraint() {
+	// x̓蔻ɂ߂荞񂾏ꍇAʒuC (߂荞݉)
+	if (staticColliders) {
+		staticColliders->ResolveParticles(particles, 0, numNodes, collisionRadius);
+	}
+}
+
+// ------------------------------------------------------------------------
+// PBD Xebv 3: ŏIʒu̍XVƑx̍ČvZ
+// ------------------------------------------------------------------------
+void PopRingCore::UpdatePositions(float dt) {
+	// VxvZ (C̈ʒuƑÖʒu̍) AKp
+	// v = (p_new - p_old) / dt * damping
+	particles.UpdateVelocities(dt, dampingFactor);
+}
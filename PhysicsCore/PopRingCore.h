@@ -0,0 +1,103 @@
+#pragma once
+#include "PhysicsMath.h"
+#include "ISoftBody.h"
+#include "DistanceConstraints.h"
+
+// d͂ŗďŒeރOPBDvZ (`PopRingManager)
+class PopRingCore : public ISoftBody {
+private:
+	ParticleStore particles; // O\m[h (_) ̔z
+	int numNodes;            // m[h̐
+	float initialRadius;     // Ȍa
+	Vec2F center;            // ȌSW
+
+	// PBD p[^ (ԍ݂͌ĂяǒŒXebvg)
+	const int PBD_ITERATIONS = 3;         // 񐔂̏̊l (قǍdmɂȂ)
+	int iterations = PBD_ITERATIONS;      // ۂɎg (΂Oɂ߂)
+	SolverMode solverMode = SolverMode::PBD;
+	float stepDt = 0.0f;                  // Integrate Ŏ󂯎Xebv (XPBD Ŏg)
+	float collisionRadius = 0.0f;         // ̂̕ƏՓ˂Ƃ̃m[h̔a (0 ȂՓ˂Ȃ)
+
+	// p[^
+	const Vec2F GRAVITY = { 0.0f, 9.8f * 10.0f }; // d͉x (Y)
+	float dampingFactor;     // x̌ (CRȂ)
+
+	// p[^
+	float distanceStiffness; // ̍ (e͐)
+	float initialSegmentLength; // אڃm[hԂ̏
+	DistanceConstraints edges;  // אڃm[hԂ̋ (PBD ł͏d݂ɍƎʂ̔܂߂)
+
+	// ʐϐ (tp`ʐρBCЂ)
+	float restArea;             // zu̕tʐ
+	float pressure = 1.0f;      // ڕWʐ = restArea * pressure (1 傫Ɩc݁AƂڂ)
+	float areaStiffness = 1.0f; // PBD ̂Ƃ̖ʐϐ̍ (0.0`1.0)
+	float areaCompliance = 0.0f; // XPBD ̂Ƃ̖ʐϐ̏_炩
+	float areaLambda = 0.0f;    // XPBD ̗ݐσOW搔
+	FloatArray gradX, gradY;    // ʐς̊em[hɂĂ̌z (Xebvg)
+
+public:
+	/**
+	 * @brief RXgN^
+	 * @param num m[h
+	 * @param r a
+	 * @param center_pos SW
+	 */
+	PopRingCore(int num, float r, Vec2F center_pos);
+
+	/**
+	 * @brief V~[V̍XV
+	 * @param dt ԍ (ŒXebvn)
+	 */
+	void Update(float dt);
+
+	// ISoftBody (Update ͂4ɌĂ)
+	void Integrate(float dt) override { stepDt = dt; ApplyExternalForces(dt); }
+	void SolveConstraints() override;
+	void SolveCollisions() override { ApplyCollisionConstraint(); }
+	void UpdateVelocities(float dt) override { UpdatePositions(dt); }
+	ParticleStore* GetParticles() override { return &particles; }
+	CollisionShape GetCollisionShape() const override { return { numNodes, true, collisionRadius }; }
+	// Ɩʐϐ1
+	int ConstraintCount() const override { return edges.Size() + 1; }
+	int IterationLimit() const override { return iterations; }
+
+	const ParticleStore& Particles() const { return particles; }
+	int NodeCount() const { return numNodes; }
+
+	/**
+	 * @brief ̉؂ւ
+	 * @param mode PBD Ȃ distanceStiffness Ɣ񐔂ōd܂AXPBD Ȃ compliance Ō܂
+	 * @param compliance XPBD ̂Ƃ̋̏_炩 (0 ȂLтȂ)
+	 */
+	void SetSolverMode(SolverMode mode, float compliance = 0.0f);
+	void SetIterations(int count) { iterations = (count < 1) ? 1 : count; }
+	// ̂̕ƏՓ˂Ƃ̃m[h̔a (0 ȂՓ˂Ȃ)
+	void SetCollisionRadius(float r) { collisionRadius = r; }
+
+	//  (ڕWʐςƏʐς̔)B1 Ō̑傫A2 Ȃʐς2{ɂȂ܂Ŗc
+	// (~܂`ς̂ŁAĂ΋N)
+	void SetPressure(float value) { pressure = value; Wake(); }
+	float Pressure() const { return pressure; }
+	// XPBD ̂Ƃ̖ʐϐ̏_炩 (0 ȂʐςςȂ)
+	void SetAreaCompliance(float compliance) { areaCompliance = compliance; }
+	// ݂̕tʐ
+	float CurrentArea() const;
+
+	//  (͋ԖځEԖځEpڂ̐F)
+	void SetConstraintOrder(ConstraintOrder order) { edges.SetOrder(order); }
+	ConstraintOrder GetConstraintOrder() const { return edges.Order(); }
+
+private:
+	// PBD Xebv 1: O͂̓KpƗ\ʒǔvZ
+	void ApplyExternalForces(float dt);
+	// solverMode ɍ킹ċ̏d݂ݒ肷
+	void ApplyEdgeWeights();
+	// PBD Xebv 2.1:  (Ǒ`ƒe͐ێ)
+	void SolveDistanceConstraints(ConstraintError* error);
+	// PBD Xebv 2.2: ʐϐ (O̖ʐςڕWʐςɕۂBׂc݂߂)
+	void SolveAreaConstraint(ConstraintError* error);
+	// PBD Xebv 2.3: Փː (ǂƂ̏Փ)
+	void ApplyCollisionConstraint();
+	// PBD Xebv 3: ŏIʒu̍XVƑx̍ČvZ
+	void UpdatePositions(float dt);
+};
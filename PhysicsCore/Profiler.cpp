@@ -0,0 +1,393 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+	const int MAX_THREADS = 32;
+	const int THREAD_BUFFER_SIZE = 8192;	// 2ׂ̂Bǂݏo܂łɂȏL^ƌÂ̂玸
+	const int TRACE_HISTORY_SIZE = 65536;	// opɎcԂ̐ (2ׂ̂)
+	const int MAX_FRAME_EVENTS = 2048;
+	const int MAX_ZONES = 128;
+	const int MAX_COUNTERS = 32;
+	// JE^̋L^͋ԂƓobt@ɁA̐[̋ԂƂď (l duration ̃rbg)
+	const int COUNTER_DEPTH = -1;
+
+	// XbhƂ̃Oobt@ (͎̂̃XbhAǂނ̂ EndFrame )
+	struct ThreadBuffer {
+		Profiler::Event events[THREAD_BUFFER_SIZE];
+		std::atomic<uint32_t> written{ 0 };		// I (傾i߂)
+		uint32_t read = 0;						// ǂݏo (EndFrame i߂)
+		std::atomic<bool> inUse{ false };
+		std::atomic<const char*> threadName{ nullptr };
+		std::atomic<int> threadId{ 0 };
+	};
+
+	ThreadBuffer g_buffers[MAX_THREADS];
+	std::atomic<int> g_nextThreadId{ 1 };
+
+	// XbhIgԂ (cĂԂ͎ EndFrame œǂ܂)
+	struct ThreadSlot {
+		ThreadBuffer* buffer = nullptr;
+		int depth = 0;
+
+		ThreadBuffer* Get() {
+			if (buffer) return buffer;
+			for (int i = 0; i < MAX_THREADS; i++) {
+				bool expected = false;
+				if (g_buffers[i].inUse.compare_exchange_strong(expected, true)) {
+					buffer = &g_buffers[i];
+					buffer->threadName.store(nullptr);
+					buffer->threadId.store(g_nextThreadId.fetch_add(1));
+					break;
+				}
+			}
+			return buffer;
+		}
+		~ThreadSlot() {
+			if (buffer) buffer->inUse.store(false);
+		}
+	};
+	thread_local ThreadSlot t_slot;
+
+	// ȉ BeginFrame / EndFrame ĂԃXbhG
+	struct TraceEvent {
+		Profiler::Event event;
+		int threadId;
+	};
+	TraceEvent g_trace[TRACE_HISTORY_SIZE];
+	uint32_t g_traceCount = 0;
+	struct ThreadInfo {
+		int threadId;
+		const char* name;
+	};
+	ThreadInfo g_threadInfo[MAX_THREADS * 4];
+	int g_threadInfoCount = 0;
+
+	int64_t g_frameBegin = 0;
+	int64_t g_lastFrameBegin = 0;
+	float g_frameMs = 0.0f;
+	float g_frameHistory[Profiler::HISTORY_FRAMES];
+	int g_historyIndex = 0;
+	int g_historyCount = 0;
+
+	Profiler::Event g_frameEvents[MAX_FRAME_EVENTS];
+	int g_frameEventCount = 0;
+
+	// Kw̏WvBẻ̓O1̐߂ɂ܂Ƃ߁At[܂œ߂g
+	struct Zone {
+		const char* name;
+		int parent;
+		int depth;
+		int calls;
+		int64_t total;
+		float history[Profiler::HISTORY_FRAMES];
+	};
+	Zone g_zones[MAX_ZONES];
+	int g_zoneCount = 0;
+
+	// JE^̏Wv (t[܂œ̂g)
+	struct CounterTrack {
+		const char* name;
+		int samples;
+		float sum;
+		float max;
+		float mean;
+		float history[Profiler::HISTORY_FRAMES];
+	};
+	CounterTrack g_counters[MAX_COUNTERS];
+	int g_counterCount = 0;
+
+	float CounterValue(const Profiler::Event& e) {
+		float value;
+		std::memcpy(&value, &e.duration, sizeof(value));
+		return value;
+	}
+
+	bool SameName(const char* a, const char* b) {
+		return a == b || std::strcmp(a, b) == 0;
+	}
+
+	int FindOrAddZone(const char* name, int parent, int depth) {
+		for (int i = 0; i < g_zoneCount; i++) {
+			if (g_zones[i].parent == parent && SameName(g_zones[i].name, name)) return i;
+		}
+		if (g_zoneCount == MAX_ZONES) return -1;
+		Zone& zone = g_zones[g_zoneCount];
+		zone.name = name;
+		zone.parent = parent;
+		zone.depth = depth;
+		zone.calls = 0;
+		zone.total = 0;
+		std::fill(zone.history, zone.history + Profiler::HISTORY_FRAMES, 0.0f);
+		return g_zoneCount++;
+	}
+
+	void Percentiles(const float* history, int count, float& p50, float& p99) {
+		if (count == 0) {
+			p50 = p99 = 0.0f;
+			return;
+		}
+		float sorted[Profiler::HISTORY_FRAMES];
+		std::copy(history, history + count, sorted);
+		const int i50 = count / 2;
+		const int i99 = (count * 99) / 100;
+		std::nth_element(sorted, sorted + i50, sorted + count);
+		p50 = sorted[i50];
+		std::nth_element(sorted, sorted + i99, sorted + count);
+		p99 = sorted[i99];
+	}
+
+	void AddCounterSample(const char* name, float value) {
+		int index = 0;
+		while (index < g_counterCount && !SameName(g_counters[index].name, name)) index++;
+		if (index == g_counterCount) {
+			if (g_counterCount == MAX_COUNTERS) return;
+			CounterTrack& track = g_counters[g_counterCount++];
+			track.name = name;
+			track.samples = 0;
+			track.sum = track.max = track.mean = 0.0f;
+			std::fill(track.history, track.history + Profiler::HISTORY_FRAMES, 0.0f);
+		}
+		CounterTrack& track = g_counters[index];
+		track.max = (track.samples == 0 || value > track.max) ? value : track.max;
+		track.sum += value;
+		track.samples++;
+	}
+
+	void RememberThread(int threadId, const char* name) {
+		for (int i = 0; i < g_threadInfoCount; i++) {
+			if (g_threadInfo[i].threadId == threadId) {
+				if (name) g_threadInfo[i].name = name;
+				return;
+			}
+		}
+		if (g_threadInfoCount == MAX_THREADS * 4) return;
+		g_threadInfo[g_threadInfoCount++] = { threadId, name };
+	}
+
+	// SXbh̃obt@VԂǂݏoBframeThread ̕ g_frameEvents ɂʂ
+	void Drain(const ThreadBuffer* frameThread) {
+		for (int t = 0; t < MAX_THREADS; t++) {
+			ThreadBuffer& buffer = g_buffers[t];
+			const uint32_t written = buffer.written.load(std::memory_order_acquire);
+			if (written == buffer.read) continue;
+			// ǂzꂽ͓ǂ߂Ȃ
+			if (written - buffer.read > THREAD_BUFFER_SIZE) buffer.read = written - THREAD_BUFFER_SIZE;
+			const int threadId = buffer.threadId.load();
+			RememberThread(threadId, buffer.threadName.load());
+			for (; buffer.read != written; buffer.read++) {
+				const Profiler::Event& e = buffer.events[buffer.read & (THREAD_BUFFER_SIZE - 1)];
+				g_trace[g_traceCount & (TRACE_HISTORY_SIZE - 1)] = { e, threadId };
+				g_traceCount++;
+				// JE^͋L^XbhɊ֌WȂWv (Ԃ̊Kwɂ͓Ȃ)
+				if (e.depth == COUNTER_DEPTH) {
+					AddCounterSample(e.name, CounterValue(e));
+					continue;
+				}
+				if (&buffer == frameThread && g_frameEventCount < MAX_FRAME_EVENTS) {
+					g_frameEvents[g_frameEventCount++] = e;
+				}
+			}
+		}
+	}
+
+	void BuildZones() {
+		// Ԃ͏IɏĂ̂ŁAn܂ (ȂO) ɕג
+		std::sort(g_frameEvents, g_frameEvents + g_frameEventCount, [](const Profiler::Event& a, const Profiler::Event& b) {
+			return a.begin != b.begin ? a.begin < b.begin : a.depth < b.depth;
+		});
+		for (int i = 0; i < g_zoneCount; i++) {
+			g_zones[i].calls = 0;
+			g_zones[i].total = 0;
+		}
+		// [Ƃɍ (-1 Ȃ炻̐[̐e͂̃t[ɂȂ)
+		const int MAX_DEPTH = 64;
+		int path[MAX_DEPTH + 1];
+		std::fill(path, path + MAX_DEPTH + 1, -1);
+		for (int i = 0; i < g_frameEventCount; i++) {
+			const Profiler::Event& e = g_frameEvents[i];
+			if (e.depth < 0 || e.depth >= MAX_DEPTH) continue;
+			// et[OɎn܂ĂƂ͈ԏɒu
+			const int parent = (e.depth == 0) ? -1 : path[e.depth - 1];
+			const int zone = FindOrAddZone(e.name, parent, (parent < 0) ? 0 : e.depth);
+			path[e.depth] = zone;
+			path[e.depth + 1] = -1;
+			if (zone < 0) continue;
+			g_zones[zone].calls++;
+			g_zones[zone].total += e.duration;
+		}
+		for (int i = 0; i < g_zoneCount; i++) {
+			g_zones[i].history[g_historyIndex] = g_zones[i].total / 1000000.0f;
+		}
+	}
+
+	// WvJE^𗚗ɓāÃt[̕󂯂
+	void BuildCounters() {
+		for (int i = 0; i < g_counterCount; i++) {
+			CounterTrack& track = g_counters[i];
+			// L^̂Ȃt[ (̃XebvȂt[Ȃ) ͑O̒l̂܂܂ɂ
+			if (track.samples > 0) track.mean = track.sum / track.samples;
+			track.history[g_historyIndex] = track.mean;
+		}
+	}
+
+	void ResetCounters() {
+		for (int i = 0; i < g_counterCount; i++) {
+			g_counters[i].samples = 0;
+			g_counters[i].sum = 0.0f;
+			g_counters[i].max = 0.0f;
+		}
+	}
+
+	// zone ̎q[D out ɏ
+	void WriteZones(int parent, Profiler::ZoneStats* out, int maxCount, int& n) {
+		for (int i = 0; i < g_zoneCount && n < maxCount; i++) {
+			const Zone& zone = g_zones[i];
+			if (zone.parent != parent) continue;
+			Profiler::ZoneStats stats;
+			stats.name = zone.name;
+			stats.depth = zone.depth;
+			stats.calls = zone.calls;
+			stats.ms = zone.total / 1000000.0f;
+			Percentiles(zone.history, g_historyCount, stats.p50, stats.p99);
+			// ߂̃t[ɈxoĂȂ (ÕV[̂̂Ȃ) ͏oȂ
+			if (stats.calls == 0 && stats.p99 == 0.0f) continue;
+			out[n++] = stats;
+			WriteZones(i, out, maxCount, n);
+		}
+	}
+}
+
+int64_t Profiler::Now() {
+	static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+int& Profiler::Depth() {
+	return t_slot.depth;
+}
+
+void Profiler::SetThreadName(const char* name) {
+	ThreadBuffer* buffer = t_slot.Get();
+	if (buffer) buffer->threadName.store(name);
+}
+
+void Profiler::Record(const char* name, int64_t begin, int64_t end, int depth) {
+	ThreadBuffer* buffer = t_slot.Get();
+	if (!buffer) return;
+	const uint32_t index = buffer->written.load(std::memory_order_relaxed);
+	Event& e = buffer->events[index & (THREAD_BUFFER_SIZE - 1)];
+	e.name = name;
+	e.begin = begin;
+	e.duration = (uint32_t)std::min<int64_t>(end - begin, UINT32_MAX);
+	e.depth = depth;
+	buffer->written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::Counter(const char* name, float value) {
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	ThreadBuffer* buffer = t_slot.Get();
+	if (!buffer) return;
+	const uint32_t index = buffer->written.load(std::memory_order_relaxed);
+	Event& e = buffer->events[index & (THREAD_BUFFER_SIZE - 1)];
+	e.name = name;
+	e.begin = Now();
+	e.duration = bits;
+	e.depth = COUNTER_DEPTH;
+	buffer->written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::BeginFrame() {
+	g_frameBegin = Now();
+}
+
+void Profiler::EndFrame() {
+	const int64_t end = Now();
+	g_frameMs = (end - g_frameBegin) / 1000000.0f;
+	g_lastFrameBegin = g_frameBegin;
+	g_frameHistory[g_historyIndex] = g_frameMs;
+
+	g_frameEventCount = 0;
+	ResetCounters();
+	Drain(t_slot.Get());
+	BuildZones();
+	BuildCounters();
+
+	g_historyIndex = (g_historyIndex + 1) % HISTORY_FRAMES;
+	if (g_historyCount < HISTORY_FRAMES) g_historyCount++;
+}
+
+float Profiler::FrameMs() {
+	return g_frameMs;
+}
+
+void Profiler::FramePercentiles(float& p50, float& p99) {
+	Percentiles(g_frameHistory, g_historyCount, p50, p99);
+}
+
+int Profiler::FrameZones(ZoneStats* out, int maxCount) {
+	int n = 0;
+	WriteZones(-1, out, maxCount, n);
+	return n;
+}
+
+int Profiler::FrameCounters(CounterStats* out, int maxCount) {
+	const int n = std::min(maxCount, g_counterCount);
+	for (int i = 0; i < n; i++) {
+		const CounterTrack& track = g_counters[i];
+		CounterStats& stats = out[i];
+		stats.name = track.name;
+		stats.samples = track.samples;
+		stats.mean = track.mean;
+		stats.max = track.max;
+		Percentiles(track.history, g_historyCount, stats.p50, stats.p99);
+	}
+	return n;
+}
+
+int Profiler::FrameEvents(Event* out, int maxCount, int64_t& frameBegin) {
+	frameBegin = g_lastFrameBegin;
+	const int n = std::min(maxCount, g_frameEventCount);
+	std::copy(g_frameEvents, g_frameEvents + n, out);
+	return n;
+}
+
+bool Profiler::WriteChromeTrace(const char* path) {
+	FILE* fp = nullptr;
+#ifdef _MSC_VER
+	if (fopen_s(&fp, path, "w") != 0) fp = nullptr;
+#else
+	fp = std::fopen(path, "w");
+#endif
+	if (!fp) return false;
+
+	std::fprintf(fp, "{\"traceEvents\":[\n");
+	bool first = true;
+	for (int i = 0; i < g_threadInfoCount; i++) {
+		if (!g_threadInfo[i].name) continue;
+		std::fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+			first ? "" : ",\n", g_threadInfo[i].threadId, g_threadInfo[i].name);
+		first = false;
+	}
+	// cĂ钆ŌÂ̂ (̓}CNb)
+	const uint32_t count = std::min<uint32_t>(g_traceCount, TRACE_HISTORY_SIZE);
+	for (uint32_t k = g_traceCount - count; k != g_traceCount; k++) {
+		const TraceEvent& t = g_trace[k & (TRACE_HISTORY_SIZE - 1)];
+		if (t.event.depth == COUNTER_DEPTH) {
+			std::fprintf(fp, "%s{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"args\":{\"value\":%g}}",
+				first ? "" : ",\n", t.event.name, t.threadId, t.event.begin / 1000.0, CounterValue(t.event));
+			first = false;
+			continue;
+		}
+		std::fprintf(fp, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+			first ? "" : ",\n", t.event.name, t.threadId, t.event.begin / 1000.0, t.event.duration / 1000.0);
+		first = false;
+	}
+	std::fprintf(fp, "\n]}\n");
+	std::fclose(fp);
+	return true;
+}
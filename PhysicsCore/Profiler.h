@@ -0,0 +1,116 @@
+#pragma once
+#include <cstdint>
+
+// PROFILING  1 ̂Ƃ PROFILE_SCOPE vԂL^ (0 Ȃ牽Ȃ)
+#ifndef PROFILING
+#define PROFILING 1
+#endif
+
+// q̌vԂL^ȈՃvt@C
+// PROFILE_SCOPE("O") uXR[v̊JnEIAXbhƂ̃Oobt@ɏB
+// ̂͂̃XbhȂ̂ŁAbN CAS Ȃ (݈ʒu release Ői߂邾)B
+//
+// t[̋؂ (BeginFrame / EndFrame) ̓CXbhĂԁBEndFrame őSXbh
+// obt@ǂݏoAEndFrame Ă񂾃Xbh̋ԂKwƂ̏WvB
+// eԂ̒ HISTORY_FRAMES t[̎Ԃ p50 / p99 oB
+// ǂݏoԂ Chrome ̃g[X (chrome://tracing / Perfetto)  JSON ɏoB
+// PROFILE_COUNTER("O", l) ŋL^l (񐔂Ȃ) obt@ɏA
+// t[Ƃ̕ρEőƁAg[X̃JE^̍sɂȂB
+//
+// O͕񃊃eȂǁAvȌI܂Ŏc镶n (|C^)
+class Profiler {
+public:
+	static const int HISTORY_FRAMES = 240;
+
+	// 1̌v
+	struct Event {
+		const char* name;
+		int64_t begin;		// imb (Now Ɠ)
+		uint32_t duration;	// imb
+		int depth;			// XbhŊOɂԂ̐
+	};
+
+	// Õt[́AKwƂ̏Wv (ẻ̓ŐԂ͂܂Ƃ߂)
+	struct ZoneStats {
+		const char* name;
+		int depth;
+		int calls;
+		float ms;	// Õt[̍v
+		float p50;	// ߂̃t[ł̒l
+		float p99;
+	};
+
+	// Õt[ŋL^JE^̏Wv
+	struct CounterStats {
+		const char* name;
+		int samples;	// Õt[ŋL^
+		float mean;		// Õt[̕ (L^Ȃ΂̑Õt[̒l̂܂)
+		float max;		// Õt[̍ő
+		float p50;		// ߂̃t[̕ς̒l
+		float p99;
+	};
+
+	// v̊̃imb
+	static int64_t Now();
+
+	// ̃Xbh̖O (g[X̍s̖OɂȂ)
+	static void SetThreadName(const char* name);
+
+	// t[̋؂
+	static void BeginFrame();
+	static void EndFrame();
+
+	// Õt[̒ (BeginFrame  EndFrame ܂) Ƃ p50 / p99
+	static float FrameMs();
+	static void FramePercentiles(float& p50, float& p99);
+
+	// Õt[̋ԂAe̎ɂ̎q鏇 ([D)  out ɏ
+	static int FrameZones(ZoneStats* out, int maxCount);
+	// Õt[ EndFrame Ă񂾃XbhL^ (Jn̑)
+	// frameBegin ɂ̓t[̊Jn
+	static int FrameEvents(Event* out, int maxCount, int64_t& frameBegin);
+
+	// Õt[܂łɋL^ꂽJE^A߂ċL^ꂽ out ɏ
+	static int FrameCounters(CounterStats* out, int maxCount);
+
+	// ǂݏoς݂̋ (SXbh)  Chrome ̃g[X`ŏo
+	static bool WriteChromeTrace(const char* path);
+
+	// ProfileScope Ă
+	static void Record(const char* name, int64_t begin, int64_t end, int depth);
+	static int& Depth();
+	// PROFILE_COUNTER Ă (ǂ̃Xbhł悢)
+	static void Counter(const char* name, float value);
+};
+
+// XR[v̊Ԃ1̋ԂƂċL^
+class ProfileScope {
+public:
+	explicit ProfileScope(const char* name)
+		:name(name), depth(Profiler::Depth()++), begin(Profiler::Now())
+	{
+	}
+	~ProfileScope() {
+		const int64_t end = Profiler::Now();
+		Profiler::Depth()--;
+		Profiler::Record(name, begin, end, depth);
+	}
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	const char* name;
+	int depth;
+	int64_t begin;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#if PROFILING
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_COUNTER(name, value) Profiler::Counter(name, (float)(value))
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_COUNTER(name, value) ((void)0)
+#endif
@@ -0,0 +1,140 @@
+#include "RopeCore.h"
+#include "StaticColliderSet.h"
+
+RopeCore::RopeCore(float startX, float startY, int nodeCount, float segLen, float maxDist, float speed)
+	: segmentLength(segLen), maxStretchDistance(maxDist), moveSpeed(speed)
+{
+	if (nodeCount < 2) nodeCount = 2;
+
+	// m[hʒu (ɔzu) ɐݒ
+	// Node 0 ͓͂œ̂ invMass  0
+	particles.Reserve(nodeCount);
+	for (int i = 0; i < nodeCount; ++i) {
+		particles.Add(startX, startY + (float)i * segLen, (i == 0) ? 0.0f : 1.0f);
+	}
+
+	// ZOgS Node 1  Node N ܂ (ID  i - 1)
+	segments.Reserve(nodeCount - 1);
+	for (int i = 1; i < nodeCount; ++i) {
+		segments.Add(i, i - 1, segLen, 0.0f, 0.0f);
+	}
+	ApplySegmentWeights();
+}
+
+void RopeCore::ApplySegmentWeights() {
+	for (int i = 1; i < particles.Size(); ++i) {
+		if (solverMode == SolverMode::XPBD) {
+			// XPBD ł͏d݂͎ʂ̋t̂ (Node 0  0)
+			segments.SetWeights(i - 1, particles.invMass[i], particles.invMass[i - 1]);
+		}
+		// Node 0 ̓[U[͂ŌŒ肳Ă邽߁ANode 1 ̍Sׂ͂Ă̏C Node 1 ɗ^
+		else if (i == 1) {
+			segments.SetWeights(i - 1, 1.0f, 0.0f);
+		}
+		// ȊÕm[h́A[ɏC𕪊
+		else {
+			segments.SetWeights(i - 1, 0.5f, 0.5f);
+		}
+	}
+}
+
+void RopeCore::SetSolverMode(SolverMode mode, float complianceValue) {
+	solverMode = mode;
+	segments.SetAllCompliance(complianceValue);
+	ApplySegmentWeights();
+}
+
+void RopeCore::Update(const BodyControl& control, float dt) {
+	stepDt = dt;
+	handleInputAndUpdateControllablePoint(control, dt);
+	updateRope();
+	SolveCollisions();
+}
+
+void RopeCore::SolveCollisions() {
+	// ǂɂ߂荞񂾃m[h߂
+	if (staticColliders) {
+		staticColliders->ResolveParticles(particles, 0, particles.Size(), collisionRadius);
+	}
+}
+
+void RopeCore::handleInputAndUpdateControllablePoint(const BodyControl& control, float dt) {
+	// Node 0 ̓[U[삷|Cg
+	float& controllableX = particles.x[0];
+	float& controllableY = particles.y[0];
+
+	// ̈ړ
+	if (control.left) {
+		controllableX -= moveSpeed * dt;
+	}
+	if (control.right) {
+		controllableX += moveSpeed * dt;
+	}
+
+	// ̈ړ
+	if (control.up) {
+		controllableY -= moveSpeed * dt;
+	}
+	if (control.down) {
+		controllableY += moveSpeed * dt;
+	}
+
+	// (ʋE͏ȗ)
+}
+
+void RopeCore::updateRope() {
+	if (particles.Size() == 0) return;
+
+	const int N = particles.Size() - 1;
+
+	// Node 0 (_) ̈ʒu
+	const Vec2f controllablePoint = particles.Position(0);
+	// Node N (Ǐ]_A) ̈ʒu
+	const Vec2f lastFixedPoint = particles.Position(N);
+
+	// ----------------------------------------------------
+	// tF[Y 1: RŜ̃O[oȍS`FbN (̃WbN)
+	// ----------------------------------------------------
+
+	// Node 0  Node N ̊Ԃ̋`FbN
+	float totalDistance = (controllablePoint - lastFixedPoint).length();
+	bool isRopeTaut = (totalDistance > maxStretchDistance);
+
+	if (isRopeTaut) {
+		// RLтE𒴂ꍇANode N  Node 0 ËʒuɈړ
+		Vec2f direction = normalize(lastFixedPoint - controllablePoint);
+		particles.SetPosition(N, controllablePoint + direction * maxStretchDistance);
+	}
+
+	// ----------------------------------------------------
+	// tF[Y 2: m[hԂ̃ZOgS (/Ǐ]̃V~[V)
+	// ----------------------------------------------------
+
+	// S𕡐񔽕邱Ƃň肵 (Position-Based Dynamics̊ȈՔ)
+	// XPBD ̃OW搔̓XebvƂ 0 ςݒ
+	if (solverMode == SolverMode::XPBD) {
+		segments.ResetLambdas();
+	}
+	// ZOg̒̂ꂪ\Ȃ iterations Oɂ߂
+	Iterate(iterations, [this, &controllablePoint](ConstraintError* error) {
+
+		// S Node 1  Node N ܂ōs
+		// Phase 1  Node N ̈ʒu͊ɋCĂ邽߁A
+		// ł Node N ƂA̓ Node N-1 ɓ`d܂B
+		if (solverMode == SolverMode::XPBD) {
+			segments.SolveXPBD(particles, stepDt, error);
+		}
+		else {
+			segments.Solve(particles, error);
+		}
+
+		// dv: Node 0 ̓[U[ɂđ삳ꂽʒuɃZbg
+		particles.SetPosition(0, controllablePoint);
+	});
+}
+
+Vec2f RopeCore::normalize(const Vec2f& v) {
+	float len = v.length();
+	if (len == 0.0f) return { 0.0f, 0.0f };
+	return { v.x / len, v.y / len };
+}
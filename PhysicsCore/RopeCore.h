@@ -0,0 +1,78 @@
+#pragma once
+#include "PhysicsMath.h"
+#include "ISoftBody.h"
+#include "DistanceConstraints.h"
+
+// _ɈRPBDvZ (`StringPointManager)
+class RopeCore : public ISoftBody {
+private:
+	ParticleStore particles; // R\m[hQ
+	BodyControl control;     // ̃XebvŎg
+	DistanceConstraints segments; // ׂ荇m[hԂ̃ZOgS
+
+	float segmentLength;      // eZOgim[hԁj̗zIȒ
+	float maxStretchDistance; // RŜ̐LтE (Node 0  Node N ̊Ԃ̋)
+	float moveSpeed;          // m[h 0 (_) ̈ړx (pixels/s)
+	const int CONSTRAINT_ITERATIONS = 3; // S̔񐔂̏̊l (قǈ)
+	int iterations = CONSTRAINT_ITERATIONS; // ۂɎg (΂Oɂ߂)
+
+	SolverMode solverMode = SolverMode::PBD;
+	float collisionRadius = 0.0f; // ̂̕ƏՓ˂Ƃ̃m[h̔a (0 ȂՓ˂Ȃ)
+	float stepDt = 0.0f;      // Integrate Ŏ󂯎Xebv (XPBD Ŏg)
+
+	// solverMode ɍ킹ăZOgS̏d݂ݒ肷
+	void ApplySegmentWeights();
+
+public:
+	/**
+	 * @brief RXgN^
+	 * @param startX, startY W
+	 * @param nodeCount R̐߂̐ (2_܂ށAŏ2)
+	 * @param segLen e߂̒
+	 * @param maxDist RŜ̌E
+	 * @param speed _̈ړx (1b̈ړ)
+	 */
+	RopeCore(float startX, float startY, int nodeCount, float segLen, float maxDist, float speed);
+
+	// 1Xebv܂Ƃ߂Đi߂ (PhysicsWorld gȂƂp)
+	void Update(const BodyControl& control, float dt = 1.0f / 60.0f);
+
+	// ISoftBody
+	void SetControl(const BodyControl& newControl) override { control = newControl; if (control.Any()) Wake(); }
+	// _𓮂
+	void Integrate(float dt) override { stepDt = dt; handleInputAndUpdateControllablePoint(control, dt); }
+	// R̍S
+	void SolveConstraints() override { updateRope(); }
+	// x̓蔻肩牟o
+	void SolveCollisions() override;
+	ParticleStore* GetParticles() override { return &particles; }
+	// R͗[J܂ƂďՓ˂
+	CollisionShape GetCollisionShape() const override { return { particles.Size(), false, collisionRadius }; }
+	int ConstraintCount() const override { return segments.Size(); }
+	int IterationLimit() const override { return iterations; }
+
+	const ParticleStore& Particles() const { return particles; }
+
+	/**
+	 * @brief WASDL[͂ɂm[h 0 (_) ̈ʒuXV
+	 */
+	void handleInputAndUpdateControllablePoint(const BodyControl& control, float dt);
+
+	/**
+	 * @brief RŜ̓ƍSXV܂
+	 */
+	void updateRope();
+
+	/**
+	 * @brief S̉؂ւ܂
+	 * @param mode PBD Ȃ甽񐔂ōd܂AXPBD Ȃ compliance Ō܂
+	 * @param complianceValue XPBD ̂Ƃ̃ZOg̏_炩 (0 ȂLтȂ)
+	 */
+	void SetSolverMode(SolverMode mode, float complianceValue = 0.0f);
+	void SetIterations(int count) { iterations = (count < 1) ? 1 : count; }
+	// ̂̕ƏՓ˂Ƃ̃m[h̔a (0 ȂՓ˂Ȃ)
+	void SetCollisionRadius(float r) { collisionRadius = r; }
+
+	// wp[֐: xNg𐳋K (1ɂ)
+	Vec2f normalize(const Vec2f& v);
+};
@@ -0,0 +1,79 @@
+#include "SimdSupport.h"
+
+#if PHYSICS_HAS_X86_SIMD
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace {
+	//  CPU 𒲂ׂ (֐ static Ȃ̂ŁAXbh瓯ɌĂ΂Ă1񂾂)
+	SimdLevel& CurrentLevel() {
+		static SimdLevel level = DetectSimdLevel();
+		return level;
+	}
+
+#if PHYSICS_HAS_X86_SIMD
+	void CpuId(int leaf, int subLeaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+		int r[4];
+		__cpuidex(r, leaf, subLeaf);
+		for (int i = 0; i < 4; ++i) regs[i] = (unsigned int)r[i];
+#else
+		__cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+	}
+
+	unsigned long long ReadXcr0() {
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		unsigned int eax, edx;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return ((unsigned long long)edx << 32) | eax;
+#endif
+	}
+#endif
+}
+
+SimdLevel DetectSimdLevel() {
+#if PHYSICS_HAS_X86_SIMD
+	unsigned int regs[4];
+	CpuId(0, 0, regs);
+	const unsigned int maxLeaf = regs[0];
+
+	CpuId(1, 0, regs);
+	const bool sse2 = (regs[3] & (1u << 26)) != 0;
+	const bool osxsave = (regs[2] & (1u << 27)) != 0;
+	const bool avx = (regs[2] & (1u << 28)) != 0;
+	if (!sse2) return SimdLevel::Scalar;
+
+	// AVX2  CPU ̑ΉɉāAOS  YMM WX^ޔĂKv
+	if (maxLeaf >= 7 && osxsave && avx && (ReadXcr0() & 0x6) == 0x6) {
+		CpuId(7, 0, regs);
+		if ((regs[1] & (1u << 5)) != 0) return SimdLevel::AVX2;
+	}
+	return SimdLevel::SSE2;
+#else
+	return SimdLevel::Scalar;
+#endif
+}
+
+SimdLevel GetSimdLevel() {
+	return CurrentLevel();
+}
+
+void SetSimdLevel(SimdLevel level) {
+	SimdLevel supported = DetectSimdLevel();
+	CurrentLevel() = ((int)level > (int)supported) ? supported : level;
+}
+
+const char* SimdLevelName(SimdLevel level) {
+	switch (level) {
+	case SimdLevel::SSE2: return "SSE2";
+	case SimdLevel::AVX2: return "AVX2";
+	default: return "Scalar";
+	}
+}
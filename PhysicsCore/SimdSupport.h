@@ -0,0 +1,26 @@
+#pragma once
+
+// x86 / x64 ̂Ƃ SSE2 / AVX2 ̃J[lrh
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PHYSICS_HAS_X86_SIMD 1
+#else
+#define PHYSICS_HAS_X86_SIMD 0
+#endif
+
+// J[lg߃Zbg
+enum class SimdLevel {
+	Scalar,
+	SSE2,
+	AVX2,
+};
+
+// CPUID āA CPU ŎgԍL߃ZbgԂ
+SimdLevel DetectSimdLevel();
+
+// ݃J[lgĂ閽߃Zbg (Ăяo DetectSimdLevel Ō܂)
+// SetSimdLevel ̓Xebv ([J[Ă) ɌĂ΂Ȃ
+SimdLevel GetSimdLevel();
+// ߃Zbg (reXg⃊vCpBCPU ΉĂȂꍇ͉)
+void SetSimdLevel(SimdLevel level);
+
+const char* SimdLevelName(SimdLevel level);
@@ -0,0 +1,38 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+
+// AƂőł؂邽߂̐ݒ (PhysicsWorld Ŝɓn)
+struct ConvergenceSettings {
+	float tolerance = 0.0f;	// ᔽ̍ő (px) ȉɂȂł؂ (0 Ȃł؂Ȃ)
+	int minIterations = 1;	// ᔽĂAԐ؂łK񂷉
+	int64_t deadline = 0;	// Profiler::Now() ߂ minIterations őł؂ (0 Ȃ玞Ԃ̐Ȃ)
+};
+
+// ̈ᔽ (ׂl̂Bpx) ̏Wv
+struct ConstraintError {
+	float max = 0.0f;
+	float sumSq = 0.0f;
+	int count = 0;
+
+	void Add(float error) {
+		const float e = std::fabs(error);
+		if (e > max) max = e;
+		sumSq += e * e;
+		++count;
+	}
+	void Merge(const ConstraintError& other) {
+		if (other.max > max) max = other.max;
+		sumSq += other.sumSq;
+		count += other.count;
+	}
+	float Rms() const { return count > 0 ? std::sqrt(sumSq / count) : 0.0f; }
+};
+
+// ÕXebvŐ (vp)
+struct SolverStats {
+	int iterations = 0;		// 񂵂̉ (TuXebv̍v)
+	int timedOut = 0;		// Ԑ؂őł؂
+	float maxError = 0.0f;	// Ō̃TuXebv̍Ō̔ŁAe𒼂Oɑᔽ̍ő
+	float rmsError = 0.0f;	// 敽ϕ
+};
@@ -0,0 +1,110 @@
+#include "SpatialHashGrid.h"
+#include <cmath>
+
+namespace {
+	// ͈͂̎ɑĂZ (Ŕ͈͂ߒȂ悤)
+	const int FIT_MARGIN = 4;
+	// Z̏͗vf̂̔{܂ (̃ZǂގԂƃ})
+	const int MAX_CELLS_PER_ELEMENT = 8;
+	const int MIN_MAX_CELLS = 1024;
+}
+
+int SpatialHashGrid::CellCoordX(float v) const {
+	return (int)std::floor(v * invCellSize) - originX;
+}
+
+int SpatialHashGrid::CellCoordY(float v) const {
+	return (int)std::floor(v * invCellSize) - originY;
+}
+
+void SpatialHashGrid::Fit(float minX, float minY, float maxX, float maxY) {
+	const long long maxCells = (long long)count * MAX_CELLS_PER_ELEMENT + MIN_MAX_CELLS;
+	cellSize = requestedCellSize;
+	for (;;) {
+		invCellSize = 1.0f / cellSize;
+		originX = (int)std::floor(minX * invCellSize) - FIT_MARGIN;
+		originY = (int)std::floor(minY * invCellSize) - FIT_MARGIN;
+		width = (int)std::floor(maxX * invCellSize) - originX + 1 + FIT_MARGIN;
+		height = (int)std::floor(maxY * invCellSize) - originY + 1 + FIT_MARGIN;
+		if ((long long)width * height <= maxCells) break;
+		// ͈͂L (ł_) Ƃ̓Z傫
+		cellSize *= 2.0f;
+	}
+	cellStart.assign((size_t)width * height + 1, 0);
+}
+
+void SpatialHashGrid::Build(const float* x, const float* y, int newCount, float newCellSize) {
+	// _͈̔ (NaN ͔rׂċUɂȂ̂Ŕ͈͂ɂ͓Ȃ)
+	float minX = HUGE_VALF, minY = HUGE_VALF, maxX = -HUGE_VALF, maxY = -HUGE_VALF;
+	for (int i = 0; i < newCount; ++i) {
+		if (x[i] < minX) minX = x[i];
+		if (x[i] > maxX) maxX = x[i];
+		if (y[i] < minY) minY = y[i];
+		if (y[i] > maxY) maxY = y[i];
+	}
+	if (minX > maxX || minY > maxY) {
+		minX = minY = maxX = maxY = 0.0f;
+	}
+
+	bool layoutChanged = (newCount != count || newCellSize != requestedCellSize);
+	if (!layoutChanged) {
+		// ͈̔͂͂ݏo_Όߒ
+		const float left = (float)originX * cellSize;
+		const float top = (float)originY * cellSize;
+		layoutChanged = (minX < left || minY < top ||
+			maxX >= left + (float)width * cellSize || maxY >= top + (float)height * cellSize);
+	}
+	if (layoutChanged) {
+		count = newCount;
+		requestedCellSize = newCellSize;
+		Fit(minX, minY, maxX, maxY);
+		cellOf.assign(count, -1);
+		sorted.resize(count);
+	}
+
+	// Z܂vf邩ȂAevf̃Zߒ
+	bool moved = layoutChanged;
+	for (int i = 0; i < count; ++i) {
+		int cx = CellCoordX(x[i]);
+		int cy = CellCoordY(y[i]);
+		// ͈͂̊O (NaN Ȃ) ͒[̃ZɓĂ
+		if (cx < 0) cx = 0; else if (cx > width - 1) cx = width - 1;
+		if (cy < 0) cy = 0; else if (cy > height - 1) cy = height - 1;
+		const int cell = cy * width + cx;
+		if (cell != cellOf[i]) {
+			cellOf[i] = cell;
+			moved = true;
+		}
+	}
+	rebuilt = moved;
+	if (!moved) return;
+
+	// JEeBO\[g: ZƂ̌  ݐϘa  lߍ
+	const int cellCount = width * height;
+	cellStart.assign((size_t)cellCount + 1, 0);
+	for (int i = 0; i < count; ++i) {
+		cellStart[cellOf[i] + 1]++;
+	}
+	for (int c = 0; c < cellCount; ++c) {
+		cellStart[c + 1] += cellStart[c];
+	}
+	// ݈ʒu cellStart 1炵ln߁AŌɌɖ߂
+	for (int i = 0; i < count; ++i) {
+		sorted[cellStart[cellOf[i]]++] = i;
+	}
+	for (int c = cellCount; c > 0; --c) {
+		cellStart[c] = cellStart[c - 1];
+	}
+	cellStart[0] = 0;
+}
+
+void SpatialHashGrid::AdoptSortedOrder() {
+	scratch.resize(count);
+	for (int k = 0; k < count; ++k) {
+		scratch[k] = cellOf[sorted[k]];
+	}
+	cellOf.swap(scratch);
+	for (int k = 0; k < count; ++k) {
+		sorted[k] = k;
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <vector>
+
+// _̏WlObhɐU蕪L攻 (broad phase)
+// _͈̔͂𕢂2̃ZzAvfԍZɕבւ
+// 1{̔zɋl߂ (JEeBO\[g)BZ͍sƂɘAĂ̂ŁA
+// `ɂvf́us̐v̘AԂƂēǂ߂B
+//
+// Zԍ͍WZTCYŊW璼ڌ܂ (ԃnbV̏Փ˂Ȃ)B
+// ͈͂L肷ăZȂ肷Ƃ́AZ傫Đ}B
+//
+// Build ͖TuXebvĂԑzBO񂩂vfEZTCYE͈͂ς炸A
+// ǂ̗vfZ܂łȂΕבւȗ (ʒu͔ԍň̂ŕт͂̂܂܎g)B
+// Ăяovf̔z񎩑̂Zɕבւ AdoptSortedOrder ĂłƁA
+// ߖT𒲂ׂƂɓǂވʒuAA Build ł͂قƂǂ̗vf̂܂܂̕тōς
+class SpatialHashGrid {
+public:
+	// x, y  count ̓_ cellSize ȏ̃ZɐU蕪
+	void Build(const float* x, const float* y, int count, float cellSize);
+
+	// (px, py) ܂ރZƂ̎8Zɂvf̔ԍ fn(index) ɓn
+	// cellSize ȓɂ_ׂ͂ēn (艓_邱Ƃ)
+	template<class F>
+	void ForEachNear(float px, float py, F&& fn) const {
+		const int cx = CellCoordX(px);
+		const int cy = CellCoordY(py);
+		VisitCells(cx - 1, cy - 1, cx + 1, cy + 1, fn);
+	}
+
+	// ` (minX, minY)-(maxX, maxY) ɂZɂvf̔ԍ fn(index) ɓn
+	template<class F>
+	void ForEachInBox(float minX, float minY, float maxX, float maxY, F&& fn) const {
+		VisitCells(CellCoordX(minX), CellCoordY(minY), CellCoordX(maxX), CellCoordY(maxY), fn);
+	}
+
+	// Zɕׂvfԍ (k Ԗڂ̃Z̈ʒu SortedOrder()[k] Ԃ̗vf)
+	const std::vector<int>& SortedOrder() const { return sorted; }
+	// Ăяovf SortedOrder ̏ɕבւƂ`
+	// Ȍ̗vfԍ͕בւ̂̂ɂȂAZ̗vf͔ԍA
+	void AdoptSortedOrder();
+
+	// ۂɎgĂZ̑傫 (͈͂L Build ɓnl傫Ȃ)
+	float CellSize() const { return cellSize; }
+	// O Build ŕבւ蒼 (vp)
+	bool Rebuilt() const { return rebuilt; }
+
+private:
+	float requestedCellSize = 0.0f;
+	float cellSize = 0.0f;
+	float invCellSize = 0.0f;
+	int count = 0;
+	// Zz񂪕͈ (̃ZW originX ` originX + width - 1)
+	int originX = 0, originY = 0;
+	int width = 0, height = 0;
+	std::vector<int> cellOf;      // vf  Zԍ (sD)
+	std::vector<int> cellStart;   // Zԍ  sorted ̊Jnʒu (width * height + 1 )
+	std::vector<int> sorted;      // Zɕׂvfԍ
+	std::vector<int> scratch;     // AdoptSortedOrder ̍Ɨp
+	bool rebuilt = false;
+
+	// ͈͂ߒ (_͂ݏoƂƁAvfEZTCYςƂ)
+	void Fit(float minX, float minY, float maxX, float maxY);
+	int CellCoordX(float v) const;
+	int CellCoordY(float v) const;
+
+	// Z͈ [cx0, cx1] x [cy0, cy1] 𒲂ׂ (͈͂̊Oɂ͗vfȂ̂Ő؂l߂)
+	template<class F>
+	void VisitCells(int cx0, int cy0, int cx1, int cy1, F& fn) const {
+		if (cx0 < 0) cx0 = 0;
+		if (cy0 < 0) cy0 = 0;
+		if (cx1 > width - 1) cx1 = width - 1;
+		if (cy1 > height - 1) cy1 = height - 1;
+		if (cx0 > cx1) return;
+		// 1s̃Z sorted 1̘AԂɂȂ
+		for (int cy = cy0; cy <= cy1; ++cy) {
+			const int row = cy * width;
+			const int end = cellStart[row + cx1 + 1];
+			for (int s = cellStart[row + cx0]; s < end; ++s) {
+				fn(sorted[s]);
+			}
+		}
+	}
+};
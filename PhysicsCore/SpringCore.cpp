@@ -0,0 +1,61 @@
+#include "SpringCore.h"
+
+SpringCore::SpringCore() {
+	InitializeSpring();
+}
+
+void SpringCore::Update(const BodyControl& control, float deltaTime) {
+	// i߂Öʒu`ԗpɎc
+	SaveRenderState();
+	Advance(control, deltaTime);
+}
+
+void SpringCore::Advance(const BodyControl& control, float deltaTime) {
+	ApplyExternalForce(control);
+
+	// 1. ψ (R̐Lт܂͏k) vZ
+	// ψ x ́A݂̒ - R
+	double currentLength = rightPoint.x - FIXED_X;
+	double x = currentLength - NATURAL_LENGTH;
+
+	// 2. ol̗ (tbN̖@: F_spring = -k * x)
+	double F_spring = -SPRING_CONSTANT * x;
+
+	// 3.  (R: F_damp = -d * v)
+	double F_damp = -DAMPING_CONSTANT * rightPoint.v;
+
+	// 4.  (F = F_spring + F_damp + F_external)
+	// O̗ (F_external)  ApplyExternalForce ֐ŉxɓKpς݂Ƃ
+	double F_net = F_spring + F_damp;
+
+	// 5. j[g̉^ (a = F / m)
+	// F_net pĉxXV
+	rightPoint.a += F_net / MASS;
+
+	// 6. xƈʒu̍XV (IC[@)
+	rightPoint.v += rightPoint.a * deltaTime;
+	rightPoint.x += rightPoint.v * deltaTime;
+
+	// 7. x̃Zbgĩt[̍͌vZɔj
+	rightPoint.a = 0.0;
+}
+
+void SpringCore::InitializeSpring() {
+	rightPoint.x = (double)FIXED_X + NATURAL_LENGTH + INITIAL_X_OFFSET; // R+ItZbg
+	rightPoint.v = 0.0;
+	rightPoint.a = 0.0;
+}
+
+void SpringCore::ApplyExternalForce(const BodyControl& control) {
+	// O̗͂ɂĉx𒼐ډ
+	const double EXTERNAL_ACCEL = 500.0; // O̗͂̋ixƂĕ\j
+
+	// DL[ŉE֗͂
+	if (control.right) {
+		rightPoint.a += EXTERNAL_ACCEL;
+	}
+	// AL[ō֗͂
+	if (control.left) {
+		rightPoint.a -= EXTERNAL_ACCEL;
+	}
+}
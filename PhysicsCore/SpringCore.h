@@ -0,0 +1,79 @@
+#pragma once
+#include "ISoftBody.h"
+
+// --- _\ ---
+struct Point {
+	double x; // ʒu
+	double v; // x
+	double a; // x
+};
+
+// [Œ肵oľvZ (`SpringManager)
+class SpringCore : public ISoftBody {
+public:
+	SpringCore();
+
+	// 1Xebv܂Ƃ߂Đi߂ (PhysicsWorld gȂƂpB`ԗp̏Ԃŕۑ)
+	void Update(const BodyControl& control, float deltaTime);
+
+	// ISoftBody (_Ȃ̂ŁAϕtF[Y1Xebv܂邲Ɛi߂)
+	void SetControl(const BodyControl& newControl) override { control = newControl; }
+	void SaveRenderState() override { renderPrevX = rightPoint.x; }
+	// (`ԗp̏Ԃ PhysicsWorld ŏ̃TuXebv̑O SaveRenderState ŕۑ)
+	void Integrate(float dt) override { Advance(control, dt); }
+	void SolveConstraints() override {}
+	// ol1{
+	int ConstraintCount() const override { return 1; }
+	// `ɂ͉E̎_1n
+	int RenderPointCount() override { return 1; }
+	void WriteRenderPoints(SnapshotPoint* out) override {
+		out[0].previous = { (float)renderPrevX, (float)FIXED_Y };
+		out[0].current = { (float)rightPoint.x, (float)FIXED_Y };
+		out[0].velocity = { (float)rightPoint.v, 0.0f };
+	}
+
+	// _Ȃ̂ŁAE̎_̈ʒuƑx
+	uint32_t HashState(uint32_t hash) override {
+		hash = HashStateBits(hash, &rightPoint.x, sizeof(rightPoint.x));
+		return HashStateBits(hash, &rightPoint.v, sizeof(rightPoint.v));
+	}
+
+	// Ō̃Xebv̑O alpha ŕԂE̎_X
+	double InterpolatedX(float alpha) const { return renderPrevX + (rightPoint.x - renderPrevX) * alpha; }
+
+	const Point& RightPoint() const { return rightPoint; }
+	int FixedX() const { return FIXED_X; }
+	int FixedY() const { return FIXED_Y; }
+
+private:
+	// --- ֐vg^Cv錾 ---
+	// ͂đxƈʒu deltaTime i߂
+	void Advance(const BodyControl& control, float deltaTime);
+	void InitializeSpring();
+	void ApplyExternalForce(const BodyControl& control);
+
+	// --- O[oϐ ---
+	Point rightPoint;
+
+	// --- 萔` ---
+	// ʂ̑傫 (kg)
+	const float MASS = 1.0f;
+	// ΂˒萔 (N/m)
+	const float SPRING_CONSTANT = 10.0f;
+	// 萔 (CRȂǂV~[g)
+	const float DAMPING_CONSTANT = 1.0f;
+	// ol̎R (pixels)
+	const int NATURAL_LENGTH = 200;
+
+	// Œ|Cg̍W
+	const int FIXED_X = 100;
+	const int FIXED_Y = 200;
+
+	// ʒũItZbgiR̈ʒuj
+	const int INITIAL_X_OFFSET = 0;
+
+	// ̃XebvŎg
+	BodyControl control;
+	// `ԗp: Ō̃Xebvn߂OX
+	double renderPrevX = 0.0;
+};
@@ -0,0 +1,68 @@
+#include "SpringGravityCore.h"
+
+SpringGravityCore::SpringGravityCore() {
+	InitializeSpring();
+}
+
+void SpringGravityCore::Update(const BodyControl& control, float deltaTime) {
+	// i߂Öʒu`ԗpɎc
+	SaveRenderState();
+	Advance(control, deltaTime);
+}
+
+void SpringGravityCore::Advance(const BodyControl& control, float deltaTime) {
+	// O̗͂̓Kp (L[)
+	ApplyExternalForce(control);
+
+	// 1. ψ (R̐Lт܂͏k) vZ
+	// ݂̒: lowerPoint.y - FIXED_Y
+	// L x ́A݂̒ - RBiY+jLт̐B
+	double currentLength = lowerPoint.y - FIXED_Y;
+	double x = currentLength - NATURAL_LENGTH;
+
+	// 2. ol̗ (tbN̖@: F_spring = -k * x)
+	// L(x>0)̏ꍇAF_spring͏iY-jɂȂ邽߁A̓}CiXB
+	double F_spring = -SPRING_CONSTANT * x;
+
+	// 3.  (R: F_damp = -d * v)
+	// xƋt
+	double F_damp = -DAMPING_CONSTANT * lowerPoint.v;
+
+	// 4. d (F_gravity = M * G)
+	// d͂͏ɉiYjɓ
+	double F_gravity = MASS * GRAVITY_ACCEL;
+
+	// 5.  (F = F_spring + F_damp + F_gravity + F_external)
+	// F_external (L[)  ApplyExternalForce ֐ŉxɓKpς݂Ƃ
+	double F_net = F_spring + F_damp + F_gravity;
+
+	// 6. j[g̉^ (a = F / m)
+	// F_net pĉxXV
+	lowerPoint.a += F_net / MASS;
+
+	// 7. xƈʒu̍XV (IC[@)
+	lowerPoint.v += lowerPoint.a * deltaTime;
+	lowerPoint.y += lowerPoint.v * deltaTime;
+
+	// 8. x̃Zbgĩt[̍͌vZɔj
+	lowerPoint.a = 0.0;
+}
+
+void SpringGravityCore::InitializeSpring() {
+	// ʒuR̈ʒuɐݒ
+	lowerPoint.y = (double)FIXED_Y + NATURAL_LENGTH;
+	lowerPoint.v = 0.0;
+	lowerPoint.a = 0.0;
+}
+
+void SpringGravityCore::ApplyExternalForce(const BodyControl& control) {
+	// WL[ŏ֗͂iYj
+	if (control.up) {
+		lowerPoint.a -= EXTERNAL_ACCEL;
+	}
+	// SL[ŉ֗͂iYj
+	if (control.down) {
+		lowerPoint.a += EXTERNAL_ACCEL;
+	}
+	// D/AL[͍̏폜
+}
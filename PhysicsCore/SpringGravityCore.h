@@ -0,0 +1,79 @@
+#pragma once
+#include "ISoftBody.h"
+
+// [Œ肵d͂Œ݂艺oľvZ (`SpringAndGravityManager)
+class SpringGravityCore : public ISoftBody {
+public:
+	SpringGravityCore();
+
+	// 1Xebv܂Ƃ߂Đi߂ (PhysicsWorld gȂƂpB`ԗp̏Ԃŕۑ)
+	void Update(const BodyControl& control, float deltaTime);
+
+	// ISoftBody (_Ȃ̂ŁAϕtF[Y1Xebv܂邲Ɛi߂)
+	void SetControl(const BodyControl& newControl) override { control = newControl; }
+	void SaveRenderState() override { renderPrevY = lowerPoint.y; }
+	// (`ԗp̏Ԃ PhysicsWorld ŏ̃TuXebv̑O SaveRenderState ŕۑ)
+	void Integrate(float dt) override { Advance(control, dt); }
+	void SolveConstraints() override {}
+	// ol1{
+	int ConstraintCount() const override { return 1; }
+	// `ɂ͉̎_1n
+	int RenderPointCount() override { return 1; }
+	void WriteRenderPoints(SnapshotPoint* out) override {
+		out[0].previous = { (float)FIXED_X, (float)renderPrevY };
+		out[0].current = { (float)FIXED_X, (float)lowerPoint.y };
+		out[0].velocity = { 0.0f, (float)lowerPoint.v };
+	}
+
+	// _Ȃ̂ŁA̎_̈ʒuƑx
+	uint32_t HashState(uint32_t hash) override {
+		hash = HashStateBits(hash, &lowerPoint.y, sizeof(lowerPoint.y));
+		return HashStateBits(hash, &lowerPoint.v, sizeof(lowerPoint.v));
+	}
+
+	// Ō̃Xebv̑O alpha ŕԂ̎_Y
+	double InterpolatedLowerY(float alpha) const { return renderPrevY + (lowerPoint.y - renderPrevY) * alpha; }
+
+	double LowerY() const { return lowerPoint.y; }
+	double Velocity() const { return lowerPoint.v; }
+	int FixedX() const { return FIXED_X; }
+	int FixedY() const { return FIXED_Y; }
+
+private:
+	// --- ֐vg^Cv錾 ---
+	// ͂đxƈʒu deltaTime i߂
+	void Advance(const BodyControl& control, float deltaTime);
+	void InitializeSpring();
+	void ApplyExternalForce(const BodyControl& control); // W/SL[̗͂Kp
+
+	// --- 萔` ---
+	const double MASS = 1.0;
+	const double SPRING_CONSTANT = 5.0;
+	const double DAMPING_CONSTANT = 0.5;
+	// ol̎R (pixels)
+	const int NATURAL_LENGTH = 150;
+	// d͉x (pixels/s^2) - `ɍ킹đ傫߂ɐݒ
+	const double GRAVITY_ACCEL = 9.8 * 50;
+
+	// Œ|Cg̍Wi㑤j
+	const int FIXED_X = 320;
+	const int FIXED_Y = 100;
+
+	// O̗͂̋ixƂĕ\j
+	const double EXTERNAL_ACCEL = 500.0;
+
+	// --- _\ (Y̓ɓ) ---
+	struct Point {
+		double y; // Yʒu
+		double v; // x
+		double a; // x
+	};
+
+	// --- O[oϐ ---
+	Point lowerPoint;
+
+	// ̃XebvŎg
+	BodyControl control;
+	// `ԗp: Ō̃Xebvn߂OY
+	double renderPrevY = 0.0;
+};
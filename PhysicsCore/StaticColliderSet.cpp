@@ -0,0 +1,201 @@
+#include "StaticColliderSet.h"
+#include <algorithm>
+#include <cmath>
+
+void StaticColliderSet::Add(const StaticCollider& collider) {
+	colliders.push_back(collider);
+	dirty = true;
+}
+
+void StaticColliderSet::AddSegment(const Vec2f& a, const Vec2f& b, float radius) {
+	Add({ StaticColliderType::Segment, a, b, radius });
+}
+
+void StaticColliderSet::AddBox(const Vec2f& minPos, const Vec2f& maxPos) {
+	Add({ StaticColliderType::Box, minPos, maxPos, 0.0f });
+}
+
+void StaticColliderSet::AddCircle(const Vec2f& center, float radius) {
+	Add({ StaticColliderType::Circle, center, center, radius });
+}
+
+void StaticColliderSet::AddPolyline(const Vec2f* points, int count, float depth) {
+	for (int i = 0; i + 1 < count; ++i) {
+		Add({ StaticColliderType::Ground, points[i], points[i + 1], depth });
+	}
+}
+
+void StaticColliderSet::Clear() {
+	colliders.clear();
+	bounds.clear();
+	nodes.clear();
+	order.clear();
+	dirty = false;
+}
+
+void StaticColliderSet::Build() {
+	const int count = Count();
+	bounds.resize(count);
+	for (int c = 0; c < count; ++c) {
+		const StaticCollider& col = colliders[c];
+		Bounds& box = bounds[c];
+		switch (col.type) {
+		case StaticColliderType::Box:
+			box = { col.a.x, col.a.y, col.b.x, col.b.y };
+			break;
+		case StaticColliderType::Circle:
+			box = { col.a.x - col.radius, col.a.y - col.radius, col.a.x + col.radius, col.a.y + col.radius };
+			break;
+		default: {
+			// ͗[͂݁A (n`Ȃ牟߂[) ̕L
+			const float r = col.radius;
+			box = { std::min(col.a.x, col.b.x) - r, std::min(col.a.y, col.b.y) - r,
+				std::max(col.a.x, col.b.x) + r, std::max(col.a.y, col.b.y) + r };
+			break;
+		}
+		}
+	}
+
+	order.resize(count);
+	for (int c = 0; c < count; ++c) order[c] = c;
+	nodes.clear();
+	nodes.reserve(count * 2);
+	if (count > 0) BuildNode(0, count, 0);
+	dirty = false;
+}
+
+int StaticColliderSet::BuildNode(int first, int count, int depth) {
+	const int index = (int)nodes.size();
+	nodes.push_back({});
+
+	// ̐߂蔻Ŝ̕܋`ƁAS̍L
+	Node node = { HUGE_VALF, HUGE_VALF, -HUGE_VALF, -HUGE_VALF, first, count, -1 };
+	float cMinX = HUGE_VALF, cMinY = HUGE_VALF, cMaxX = -HUGE_VALF, cMaxY = -HUGE_VALF;
+	for (int k = first; k < first + count; ++k) {
+		const Bounds& box = bounds[order[k]];
+		node.minX = std::min(node.minX, box.minX);
+		node.minY = std::min(node.minY, box.minY);
+		node.maxX = std::max(node.maxX, box.maxX);
+		node.maxY = std::max(node.maxY, box.maxY);
+		const float cx = (box.minX + box.maxX) * 0.5f;
+		const float cy = (box.minY + box.maxY) * 0.5f;
+		cMinX = std::min(cMinX, cx); cMaxX = std::max(cMaxX, cx);
+		cMinY = std::min(cMinY, cy); cMaxY = std::max(cMaxY, cy);
+	}
+
+	if (count > LEAF_SIZE && depth < MAX_DEPTH) {
+		// SLĂ鎲ŁAS̒l2ɕ
+		const bool splitX = (cMaxX - cMinX) >= (cMaxY - cMinY);
+		const int half = count / 2;
+		int* begin = order.data() + first;
+		std::nth_element(begin, begin + half, begin + count, [this, splitX](int l, int r) {
+			const Bounds& bl = bounds[l];
+			const Bounds& br = bounds[r];
+			return splitX ? (bl.minX + bl.maxX) < (br.minX + br.maxX)
+				: (bl.minY + bl.maxY) < (br.minY + br.maxY);
+		});
+		node.count = 0;
+		BuildNode(first, half, depth + 1);
+		node.right = BuildNode(first + half, count - half, depth + 1);
+	}
+	nodes[index] = node;
+	return index;
+}
+
+namespace {
+	// a r ̓_ p A a-b  thickness + r  ()
+	bool PushFromSegment(Vec2f& p, float r, const StaticCollider& col) {
+		const Vec2f ab = col.b - col.a;
+		const float lenSq = ab.lengthSq();
+		float t = (lenSq > 0.0f) ? ((p.x - col.a.x) * ab.x + (p.y - col.a.y) * ab.y) / lenSq : 0.0f;
+		t = std::min(std::max(t, 0.0f), 1.0f);
+		const Vec2f q = col.a + ab * t;
+		const Vec2f d = p - q;
+		const float minDist = col.radius + r;
+		const float distSq = d.lengthSq();
+		if (distSq >= minDist * minDist) return false;
+		if (distSq > 0.0f) {
+			p = q + d * (minDist / std::sqrt(distSq));
+		}
+		else {
+			// ̏ɂ傤ǏĂƂ́A̍ (EֈȂ) ֏o
+			const Vec2f n = Vec2f{ ab.y, -ab.x }.normalize();
+			p = q + n * minDist;
+		}
+		return true;
+	}
+
+	// a r ̓_ p An`1 a-b ̕\ (is̍) ֏o
+	bool PushFromGround(Vec2f& p, float r, const StaticCollider& col) {
+		const Vec2f ab = col.b - col.a;
+		const float len = ab.length();
+		if (len == 0.0f) return false;
+		// ӂ͈̔͂̊Oׂ͗̕ӂɔC
+		const float along = ((p.x - col.a.x) * ab.x + (p.y - col.a.y) * ab.y) / len;
+		if (along < 0.0f || along > len) return false;
+		// \̖@ (EֈӂȂ)
+		const Vec2f n = { ab.y / len, -ab.x / len };
+		const float height = (p.x - col.a.x) * n.x + (p.y - col.a.y) * n.y;
+		// \ r ȓ `  depth ܂œ荞񂾓_߂
+		if (height >= r || height < -col.radius) return false;
+		p += n * (r - height);
+		return true;
+	}
+
+	// a r ̓_ p A`̈ԋ߂ʂO֏o
+	bool PushFromBox(Vec2f& p, float r, const StaticCollider& col) {
+		const float left = p.x - (col.a.x - r);
+		const float right = (col.b.x + r) - p.x;
+		const float top = p.y - (col.a.y - r);
+		const float bottom = (col.b.y + r) - p.y;
+		if (left <= 0.0f || right <= 0.0f || top <= 0.0f || bottom <= 0.0f) return false;
+		const float m = std::min(std::min(left, right), std::min(top, bottom));
+		if (m == top) p.y -= top;
+		else if (m == bottom) p.y += bottom;
+		else if (m == left) p.x -= left;
+		else p.x += right;
+		return true;
+	}
+
+	// a r ̓_ p A~̊O֏o
+	bool PushFromCircle(Vec2f& p, float r, const StaticCollider& col) {
+		const Vec2f d = p - col.a;
+		const float minDist = col.radius + r;
+		const float distSq = d.lengthSq();
+		if (distSq >= minDist * minDist) return false;
+		if (distSq > 0.0f) {
+			p = col.a + d * (minDist / std::sqrt(distSq));
+		}
+		else {
+			p = col.a + Vec2f{ 0.0f, -minDist };
+		}
+		return true;
+	}
+}
+
+bool StaticColliderSet::ResolvePoint(float& x, float& y, float radius) const {
+	Vec2f p = { x, y };
+	bool hit = false;
+	Query(x - radius, y - radius, x + radius, y + radius, [&](int c) {
+		const StaticCollider& col = colliders[c];
+		switch (col.type) {
+		case StaticColliderType::Segment: hit |= PushFromSegment(p, radius, col); break;
+		case StaticColliderType::Ground: hit |= PushFromGround(p, radius, col); break;
+		case StaticColliderType::Box: hit |= PushFromBox(p, radius, col); break;
+		case StaticColliderType::Circle: hit |= PushFromCircle(p, radius, col); break;
+		}
+	});
+	x = p.x;
+	y = p.y;
+	return hit;
+}
+
+void StaticColliderSet::ResolveParticles(ParticleStore& particles, int begin, int end, float radius) const {
+	if (nodes.empty()) return;
+	// ͂œ_ (invMass  0) ǂ͔Ȃ̂ŁAʂɉo
+	float* x = particles.x.data();
+	float* y = particles.y.data();
+	for (int i = begin; i < end; ++i) {
+		ResolvePoint(x[i], y[i], radius);
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "ParticleStore.h"
+#include "PhysicsMath.h"
+#include <vector>
+
+// Ȃ蔻̎
+enum class StaticColliderType {
+	Segment, // ̂ (牟Ԃ)
+	Ground,  // Бł (܂̒n`1ӁBa  b ̐is̉Eł)
+	Box,     // ɕsȋ` (gł)
+	Circle,  // ~ (gł)
+};
+
+// Ȃ蔻1
+// Segment / Ground  a-b ̐ABox  a Eb EACircle  a S
+struct StaticCollider {
+	StaticColliderType type;
+	Vec2f a, b;
+	float radius; // Segment ̑ () / Circle ̔a / Ground ̉߂[
+};
+
+// x̐ÓIȓ蔻 (E`E~E܂̒n`) ܂Ƃ߂
+// ǉI Build ŕ܃{[Kw (BVH) B
+// 1_̖₢킹 BVH ǂA̓_̋߂ɂ铖蔻肾𒲂ׂ̂ŁA
+// 蔻̐ĂԂ͂悻 log() łȂB
+//
+// Build ͓ǂނȂ̂ŁÂ̕ SolveCollisions 瓯ɌĂł悢
+class StaticColliderSet {
+public:
+	//  radius ̐ (ǂ_B牟Ԃ)
+	void AddSegment(const Vec2f& a, const Vec2f& b, float radius = 0.0f);
+	//  minPosEE maxPos ̋`
+	void AddBox(const Vec2f& minPos, const Vec2f& maxPos);
+	// S centerEa radius ̉~
+	void AddCircle(const Vec2f& center, float radius);
+	// points ɂȂ܂̒n`
+	// is̉E (Eׂ֕Ή) łAdepth ܂ł̂߂荞݂\։߂
+	void AddPolyline(const Vec2f* points, int count, float depth = 100.0f);
+
+	void Clear();
+	// BVH 蒼 (ǉE폜̌A₢킹̑O1Ă)
+	void Build();
+	bool NeedsBuild() const { return dirty; }
+
+	int Count() const { return (int)colliders.size(); }
+	const StaticCollider& Collider(int i) const { return colliders[i]; }
+
+	// a radius ̓_ (x, y) 𓖂蔻̊O։oBo true
+	bool ResolvePoint(float& x, float& y, float radius) const;
+	// particles  [begin, end) ̎_܂Ƃ߂ĉo
+	void ResolveParticles(ParticleStore& particles, int begin, int end, float radius) const;
+
+	// ` (minX, minY)-(maxX, maxY) ƕ܋`dȂ铖蔻̔ԍ fn(index) ɓn
+	template<class F>
+	void Query(float minX, float minY, float maxX, float maxY, F&& fn) const {
+		if (nodes.empty()) return;
+		int stack[MAX_DEPTH + 2];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0) {
+			const int index = stack[--top];
+			const Node& node = nodes[index];
+			if (node.maxX < minX || node.minX > maxX || node.maxY < minY || node.minY > maxY) continue;
+			if (node.count > 0) {
+				for (int k = node.first; k < node.first + node.count; ++k) {
+					const int c = order[k];
+					const Bounds& box = bounds[c];
+					if (box.maxX < minX || box.minX > maxX || box.maxY < minY || box.minY > maxY) continue;
+					fn(c);
+				}
+			}
+			else {
+				// ̎q͂AE̎q right ɓĂ
+				stack[top++] = node.right;
+				stack[top++] = index + 1;
+			}
+		}
+	}
+
+private:
+	struct Bounds {
+		float minX, minY, maxX, maxY;
+	};
+	// BVH ̐߁Bcount > 0 Ȃt order[first, first + count) ̓蔻
+	struct Node {
+		float minX, minY, maxX, maxY;
+		int first;
+		int count;
+		int right;
+	};
+
+	// ؂̐[̏ (lŕ̂ŐSł͂ȂB͂炻ŗtɂ)
+	static const int MAX_DEPTH = 48;
+	// tɓ铖蔻̐̏
+	static const int LEAF_SIZE = 2;
+
+	std::vector<StaticCollider> colliders;
+	std::vector<Bounds> bounds;   // 蔻育Ƃ̕܋`
+	std::vector<Node> nodes;      // BVH ([D̕сB 0)
+	std::vector<int> order;       // tw蔻̔ԍ
+	bool dirty = false;
+
+	void Add(const StaticCollider& collider);
+	// order[first, first + count) ߂A̔ԍԂ
+	int BuildNode(int first, int count, int depth);
+};
@@ -0,0 +1,37 @@
+#include "WorldSnapshot.h"
+
+const SnapshotBody* WorldSnapshot::Find(const ISoftBody* body) const {
+	// ̂̐͑Ȃ̂ŏɒT
+	for (const SnapshotBody& b : bodies) {
+		if (b.body == body) return &b;
+	}
+	return nullptr;
+}
+
+void WorldSnapshot::Reset(uint64_t step, int64_t time) {
+	stepIndex = step;
+	publishTime = time;
+	bodies.clear();
+	points.clear();
+}
+
+SnapshotPoint* WorldSnapshot::AddBody(const ISoftBody* body, int count) {
+	const int first = (int)points.size();
+	bodies.push_back({ body, first, count });
+	points.resize(first + count);
+	return points.data() + first;
+}
+
+void SnapshotBuffer::Publish() {
+	// 1 middle ɒuAɑO middle ɏ1ɂ
+	// (release ŏgAǂݏo acquire 猩悤ɂ)
+	back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+const WorldSnapshot& SnapshotBuffer::Latest() {
+	// V1Ƃ front Ɠւ (ȂΑOƓ1xԂ)
+	if (middle.load(std::memory_order_relaxed) & FRESH) {
+		front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+	}
+	return slots[front];
+}
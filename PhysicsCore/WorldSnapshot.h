@@ -0,0 +1,79 @@
+#pragma once
+#include "PhysicsMath.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class ISoftBody;
+
+// `pɃRs[1̓_ (Ō̃Xebv̑ÖʒuƁAXebv̑x)
+struct SnapshotPoint {
+	Vec2f previous;
+	Vec2f current;
+	Vec2f velocity;
+};
+
+// XibvVbg̒1̂̕̕ (_̔z first  count )
+struct SnapshotBody {
+	const ISoftBody* body;
+	int first;
+	int count;
+};
+
+// 鎞_̃[h`悷̂ɕKvȕRs[AȂf[^
+// V~[VʃXbhŐi߂ĂA`͂̃Rs[ǂ߂΂悢
+class WorldSnapshot {
+public:
+	// ڂ̃Xebv̌ォ (0 Ȃ܂xi߂ĂȂ)
+	uint64_t StepIndex() const { return stepIndex; }
+	//  (imbBProfiler::Now Ɠ)
+	int64_t PublishTime() const { return publishTime; }
+
+	int BodyCount() const { return (int)bodies.size(); }
+	const SnapshotBody& Body(int i) const { return bodies[i]; }
+	// body ̕T (܂܂܂ĂȂ nullptr)
+	const SnapshotBody* Find(const ISoftBody* body) const;
+
+	const SnapshotPoint& Point(const SnapshotBody& body, int i) const { return points[body.first + i]; }
+	// Öʒu alpha (0`1) ŕԂ`p̈ʒu
+	Vec2f Interpolated(const SnapshotBody& body, int i, float alpha) const {
+		const SnapshotPoint& p = points[body.first + i];
+		return { p.previous.x + (p.current.x - p.previous.x) * alpha,
+			p.previous.y + (p.current.y - p.previous.y) * alpha };
+	}
+
+	// --- ݑ (PhysicsWorld::PublishSnapshot) ---
+	// gɂ (z̗eʂ͎ĉŁÂ̐ςȂΊmۂȂ)
+	void Reset(uint64_t step, int64_t time);
+	// body ̓̕_ count ǉāAސԂ
+	SnapshotPoint* AddBody(const ISoftBody* body, int count);
+
+private:
+	uint64_t stepIndex = 0;
+	int64_t publishTime = 0;
+	std::vector<SnapshotBody> bodies;
+	std::vector<SnapshotPoint> points;
+};
+
+// 1XbhEǂݏo1Xbh̃gvobt@
+// ݑ͋󂢂Ă1ɏ Publish ōւAǂݏo Latest ōŐV1󂯎B
+// ǂ҂Ȃ ( atomic  exchange 1) ̂ŁA
+// V~[VdĂ`͎~܂炸A`悪xĂV~[V͎~܂Ȃ
+class SnapshotBuffer {
+public:
+	// ݑ: ɏ1 (Publish ܂œǂݏo͌Ȃ)
+	WorldSnapshot& BeginWrite() { return slots[back]; }
+	// ݑ: BeginWrite ŏ1ŐVƂēn
+	void Publish();
+	// ǂݏo: ŐV1 ( Latest ĂԂ܂ŏȂ)
+	const WorldSnapshot& Latest();
+
+private:
+	static const int INDEX_MASK = 3;
+	static const int FRESH = 4;		// middle ɓǂݏo܂󂯎ĂȂ1
+
+	WorldSnapshot slots[3];
+	int back = 0;					// ݑG
+	int front = 1;					// ǂݏoG
+	std::atomic<int> middle{ 2 };	// 󂯓n1 (CfbNX | FRESH)
+};
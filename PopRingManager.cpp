@@ -1,17 +1,9 @@
 #include "PopRingManager.h"
 
-void PopRingManager::Update(float de) {
-	// PBD͒ʏAŒ^CXebvŎs
-	// 1. O͂̓KpƗ\ʒǔvZ
-	ApplyExternalForces(TIME_STEP);
-
-	// 2. ̔Iȉ
-	for (int i = 0; i < PBD_ITERATIONS; ++i) {
-		SolveDistanceConstraints();
-		SolveAreaConstraint();      // (ʐψێ)
-		ApplyCollisionConstraint(); // (Ƃ̏Փ)
-	}
-
-	// 3. ŏIʒuƑx̍XV
-	UpdatePositions(TIME_STEP);
-}
\ No newline at end of file
+PopRingManager::PopRingManager(PhysicsWorld& world, int num, float r, Vec2F center_pos) :
+	core(world.CreateBody<PopRingCore>(num, r, center_pos))
+{
+	// ̃OƂԂƂ̃m[h̔a
+	core->SetCollisionRadius(3.0f);
+	lineColor = GetColorU8(255, 255, 255, 255); // 
+}
@@ -1,253 +1,51 @@
 #pragma once
-#include <vector>
-#include <cmath>
-#include <algorithm> // std::max, std::minp
 #include "DxLib.h"   // DxLib̊֐gp
 #include "GameData.h"
+#include "PrimitiveBatch.h"
+#include "PhysicsCore/PopRingCore.h"
+#include "PhysicsCore/PhysicsWorld.h"
 
-// 2xNg/W\ (񎦂)
-struct Vec2F {
-	float x;
-	float y;
-
-	// Iy[^[I[o[[h (vZȗ)
-	Vec2F operator+(const Vec2F& other) const { return { x + other.x, y + other.y }; }
-	Vec2F operator-(const Vec2F& other) const { return { x - other.x, y - other.y }; }
-	Vec2F operator*(float scalar) const { return { x * scalar, y * scalar }; }
-
-	// **ǉ:** XJ[Z (ʂdt̋tŊۂɕ֗)
-	Vec2F operator/(float scalar) const {
-		float inv_s = 1.0f / scalar;
-		return { x * inv_s, y * inv_s };
-	}
-
-	// **ǉ:** Zq (p += dp; ̂悤Ɏg)
-	Vec2F& operator+=(const Vec2F& other) { x += other.x; y += other.y; return *this; }
-
-	// Iy[^[I[o[[h (xNg̒)
-	float lengthSq() const { return x * x + y * y; }
-	float length() const { return std::sqrt(lengthSq()); }
-
-	// **ǉ:** K (PʃxNg߂B̖@̌vZɕK{)
-	Vec2F normalize() const {
-		float len = length();
-		return (len > 0) ? *this / len : Vec2F{ 0.0f, 0.0f };
-	}
-};
-
-// m[hi_j̍\
-struct Node {
-	Vec2F position;        // **PBDK{**F݂̗\ʒu (\oŏC)
-	Vec2F previousPosition; // **PBDK{**F1Õ^CXebvł̈ʒu (xvZ̊)
-	Vec2F velocity;         // ****FxݒO͓KpɎgp
-	float mass;             // _̎
-	float invMass;          // ****Fʂ̋t (1/mass)BPBĎvZɕK{B
-
-	// ftHgRXgN^
-	Node() : position{ 0, 0 }, previousPosition{ 0, 0 }, velocity{ 0, 0 }, mass(1.0f), invMass(1.0f) {}
-
-	// ʂ̐ݒƋt̎vZ
-	void setMass(float m) {
-		mass = m;
-		invMass = (m > 0.0f) ? 1.0f / m : 0.0f; // ʃ[ij̏ꍇ͋t[ɂ
-	}
-};
-
-
-
+// PopRingCore ̕`A_v^ (vZ PhysicsCore )
+// RA PhysicsWorld AXebv PhysicsWorld::Step Ői߂
 class PopRingManager {
 private:
-	std::vector<Node> nodes; // O\m[h̔z
-	int numNodes;            // m[h̐
-	float initialRadius;     // Ȍa
-	Vec2F center;            // ȌSW
-
-	// PBD p[^
-	const float TIME_STEP = 1.0f / 60.0f; // vŽŒ莞ԍ (Dt)
-	const int PBD_ITERATIONS = 8;         //  (قǍdmɂȂ)
-
-	// p[^
-	const Vec2F GRAVITY = { 0.0f, 9.8f * 10.0f }; // d͉x (Y)
-	float floorY;            // YW
-	float dampingFactor;     // x̌ (CRȂ)
-
-	// p[^
-	float distanceStiffness; // ̍ (e͐)
-	float initialSegmentLength; // אڃm[hԂ̏
+	PopRingCore* core; // PhysicsWorld 
+	COLOR_U8 lineColor;
 
 public:
 	/**
 	 * @brief RXgN^
+	 * @param world O郏[h
 	 * @param num m[h
 	 * @param r a
 	 * @param center_pos SW
-	 * @param floor_y YW
+	 * ǂ world.Statics() ɓo^̂ƂԂ
 	 */
-	PopRingManager(int num, float r, Vec2F center_pos, float floor_y) :
-		numNodes(num), initialRadius(r), center(center_pos), floorY(floor_y),
-		dampingFactor(0.995f), distanceStiffness(0.5f) // 0.0`1.0
-	{
-		// m[h̏zu
-		nodes.reserve(numNodes);
-		for (int i = 0; i < numNodes; ++i) {
-			float angle = 2.0f * DX_PI_F * (float)i / (float)numNodes;
-			Vec2F pos = center + Vec2F{ initialRadius * std::cos(angle), initialRadius * std::sin(angle) };
+	PopRingManager(PhysicsWorld& world, int num, float r, Vec2F center_pos);
 
-			Node node;
-			node.setMass(1.0f); // ʂ1.0ɐݒ (invMass1.0ɂȂ)
-			node.position = pos;
-			node.previousPosition = pos;
-			node.velocity = { 0.0f, 0.0f };
-			nodes.push_back(node);
-		}
-		// אڃm[hԂ̏vZ
-		initialSegmentLength = (nodes[0].position - nodes[1].position).length();
-	}
-
-	/**
-	 * @brief V~[V̍XV
-	 * @param dt f^^C (gpAWIȃAbvf[g֐Ƃĕێ)
-	 */
-	void Update(float dt);
+	PopRingCore& Core() { return *core; }
 
 	/**
 	 * @brief DXCuɂ`
+	 * @param snapshot `[h̏
+	 * @param batch ߂ (`̂͌Ăяo Flush)
+	 * @param alpha O̕Xebv̕ԗ (0`1)
 	 */
-	void Draw() const {
+	void Draw(const WorldSnapshot& snapshot, PrimitiveBatch& batch, float alpha = 1.0f) const {
+		const SnapshotBody* nodes = snapshot.Find(core);
+		if (nodes == nullptr) return;
+		int numNodes = core->NodeCount();
+
 		// m[hԂŌŃO`
 		for (int i = 0; i < numNodes; ++i) {
-			const Node& current = nodes[i];
-			const Node& next = nodes[(i + 1) % numNodes]; // ̃m[hiOȂ̂ňj
+			const int next = (i + 1) % numNodes; // ̃m[hiOȂ̂ňj
+			const Vec2f pos = snapshot.Interpolated(*nodes, i, alpha);
+			const Vec2f nextPos = snapshot.Interpolated(*nodes, next, alpha);
 
-			DrawLine(
-				(int)current.position.x, (int)current.position.y,
-				(int)next.position.x, (int)next.position.y,
-				GetColor(255, 255, 255) // 
-			);
+			batch.AddLine(pos, nextPos, 1.0f, lineColor);
 
 			// m[ĥ` (fobOp)
-			// DrawCircle((int)current.position.x, (int)current.position.y, 3, GetColor(0, 255, 0), TRUE);
+			// batch.AddCircle(pos, 3.0f, GetColorU8(0, 255, 0, 255));
 		}
-
-		// ̕`
-		DrawLine(0, (int)floorY, GameData::windowWidth, (int)floorY, GetColor(0, 0, 255)); // 
 	}
-
-private:
-	// ------------------------------------------------------------------------
-	// PBD Xebv 1: O͂̓KpƗ\ʒǔvZ
-	// ------------------------------------------------------------------------
-	void ApplyExternalForces(float dt) {
-		for (auto& node : nodes) {
-			// ݂̈ʒuۑ (previousPosition)
-			node.previousPosition = node.position;
-
-			// xɏd͂Kp (Eulerϕ)
-			node.velocity += GRAVITY * dt;
-
-			// \ʒuvZ (xňړ)
-			node.position += node.velocity * dt;
-		}
-	}
-
-	// ------------------------------------------------------------------------
-	// PBD Xebv 2.1:  (Ǒ`ƒe͐ێ)
-	// ------------------------------------------------------------------------
-	void SolveDistanceConstraints() {
-		// SĂ̗אڃm[hyAɑ΂ĐKp
-		for (int i = 0; i < numNodes; ++i) {
-			Node& p1 = nodes[i];
-			Node& p2 = nodes[(i + 1) % numNodes]; // OȂ̂Ŏ̃m[h͏z
-
-			Vec2F delta = p1.position - p2.position;
-			float currentDist = delta.length();
-			float diff = currentDist - initialSegmentLength;
-
-			// z (@)
-			Vec2F n = delta.normalize();
-
-			// _ (ʒuCʂ̃XJ[)
-			// C = currentDist - initialSegmentLength
-			// S = |n|^2 / (m1 + m2) ̋t
-			float W = p1.invMass + p2.invMass; // 
-			if (W == 0.0f) continue;
-			float lambda = -diff / W;
-
-			//  (Stiffness) ̓Kp
-			lambda *= distanceStiffness;
-
-			// ʒuCxNg
-			Vec2F dp = n * lambda;
-
-			// ʂɉďCʂ𕪔z
-			p1.position += (dp * p1.invMass);
-			//p2.position -= dp * p2.invMass; // p2p1ƋtɏC
-		}
-	}
-
-	// ------------------------------------------------------------------------
-	// PBD Xebv 2.2: ʐϐ (OSɒׂ̂h)
-	// ------------------------------------------------------------------------
-	// ̐́Ãm[hiz_j2̃m[hō\Op`̖ʐςA
-	// Ŝ̖ʐςێ悤ɍpArIȒPȕ@gp܂B
-	void SolveAreaConstraint() {
-		// ȒP̂߁ASm[h̏dSzIȒS_Ƃ܂
-		Vec2F virtualCenter = { 0.0f, 0.0f };
-		for (const auto& node : nodes) {
-			virtualCenter += node.position;
-		}
-		virtualCenter = virtualCenter / (float)numNodes;
-
-		// Sm[ḧʒuAzS_O։o悤ɏC܂
-		// ͊SȖʐϐł͂܂񂪁Auׂɂve͐\ł܂
-		float currentRadiusSqSum = 0.0f;
-		for (const auto& node : nodes) {
-			currentRadiusSqSum += (node.position - virtualCenter).lengthSq();
-		}
-		float currentRadius = std::sqrt(currentRadiusSqSum / (float)numNodes);
-
-		float targetRadius = initialRadius; // ڕWa
-
-		if (currentRadius < targetRadius) {
-			float correctionFactor = 1.0f - (currentRadius / targetRadius);
-
-			// CʂXJ[Œ
-			float push_strength = 0.05f; // ʐψێ̍
-
-			for (auto& node : nodes) {
-				Vec2F dir = node.position - virtualCenter;
-				// S痣ɏC
-				node.position += dir.normalize() * correctionFactor * push_strength;
-			}
-		}
-	}
-
-	// ------------------------------------------------------------------------
-	// PBD Xebv 2.3: Փː (Ƃ̏Փ)
-	// ------------------------------------------------------------------------
-	void ApplyCollisionConstraint() {
-		for (auto& node : nodes) {
-			// ̍ (floorY) 艺ɂ߂荞񂾏ꍇ
-			if (node.position.y > floorY) {
-				// 1. ʒȕC (߂荞݉)
-				node.position.y = floorY;
-			}
-		}
-	}
-
-	// ------------------------------------------------------------------------
-	// PBD Xebv 3: ŏIʒu̍XVƑx̍ČvZ
-	// ------------------------------------------------------------------------
-	void UpdatePositions(float dt) {
-		float inv_dt = 1.0f / dt;
-		for (auto& node : nodes) {
-			// VxvZ (C̈ʒuƑÖʒu̍)
-			// v = (p_new - p_old) / dt
-			node.velocity = (node.position - node.previousPosition) * inv_dt;
-
-			// Kp
-			node.velocity.x *= dampingFactor;
-			node.velocity.y *= dampingFactor;
-		}
-	}
-};
\ No newline at end of file
+};
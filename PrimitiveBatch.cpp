@@ -0,0 +1,75 @@
+#include "PrimitiveBatch.h"
+#include <cmath>
+
+namespace {
+	//iKƂ̉~̕
+	const int SEGMENTS[] = { 8, 16, 32 };
+
+	//a番̒iKI (ʏŊpڗȂx)
+	int SegmentLevel(float radius) {
+		if (radius <= 4.0f) return 0;
+		if (radius <= 12.0f) return 1;
+		return 2;
+	}
+
+	void SetVertex(VERTEX2D& v, float x, float y, COLOR_U8 color) {
+		v.pos.x = x;
+		v.pos.y = y;
+		v.pos.z = 0.0f;
+		v.rhw = 1.0f;
+		v.dif = color;
+		v.u = 0.0f;
+		v.v = 0.0f;
+	}
+}
+
+PrimitiveBatch::PrimitiveBatch() {
+	for (int level = 0; level < SEGMENT_LEVELS; level++) {
+		const int segments = SEGMENTS[level];
+		for (int i = 0; i <= segments; i++) {
+			const float angle = 2.0f * PHYSICS_PI_F * i / segments;
+			m_unitCircle[level][i] = { std::cos(angle), std::sin(angle) };
+		}
+	}
+	m_vertices.reserve(4096);
+}
+
+VERTEX2D* PrimitiveBatch::Reserve(int count) {
+	if (VertexCount() + count > MAX_VERTICES) Flush();
+	const size_t first = m_vertices.size();
+	m_vertices.resize(first + count);
+	return m_vertices.data() + first;
+}
+
+void PrimitiveBatch::AddCircle(const Vec2f& center, float radius, COLOR_U8 color) {
+	const int level = SegmentLevel(radius);
+	const int segments = SEGMENTS[level];
+	const Vec2f* unit = m_unitCircle[level];
+	//SƉ~ׂ̗荇2_1̎Op`
+	VERTEX2D* v = Reserve(segments * 3);
+	for (int i = 0; i < segments; i++) {
+		SetVertex(*v++, center.x, center.y, color);
+		SetVertex(*v++, center.x + unit[i].x * radius, center.y + unit[i].y * radius, color);
+		SetVertex(*v++, center.x + unit[i + 1].x * radius, center.y + unit[i + 1].y * radius, color);
+	}
+}
+
+void PrimitiveBatch::AddLine(const Vec2f& a, const Vec2f& b, float thickness, COLOR_U8 color) {
+	//̌ɐȕ֑̔Llp` (Op`2)
+	const Vec2f dir = (b - a).normalize();
+	const Vec2f side = { -dir.y * thickness * 0.5f, dir.x * thickness * 0.5f };
+	VERTEX2D* v = Reserve(6);
+	SetVertex(v[0], a.x + side.x, a.y + side.y, color);
+	SetVertex(v[1], b.x + side.x, b.y + side.y, color);
+	SetVertex(v[2], b.x - side.x, b.y - side.y, color);
+	SetVertex(v[3], a.x + side.x, a.y + side.y, color);
+	SetVertex(v[4], b.x - side.x, b.y - side.y, color);
+	SetVertex(v[5], a.x - side.x, a.y - side.y, color);
+}
+
+void PrimitiveBatch::Flush() {
+	if (m_vertices.empty()) return;
+	DrawPolygon2D(m_vertices.data(), VertexCount() / 3, DX_NONE_GRAPH, FALSE);
+	//eʂ͎ĉŁÃt[͊mۂȂ
+	m_vertices.clear();
+}
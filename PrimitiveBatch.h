@@ -0,0 +1,37 @@
+#pragma once
+#include "DxLib.h"
+#include "PhysicsCore/PhysicsMath.h"
+#include <vector>
+
+// hԂ̉~Ƒ̂Op`̒_zɂ߂āAFlush  DrawPolygon2D 1ɂ܂Ƃ߂ĕ`
+// _Ƃ DrawCircle / DrawLine ĂԂƁAł͕`施߂̎󂯓n̕dȂ邽߁B
+// Op`͒ǉɕ`̂ŁAォǉ̂ɏdȂ (DrawCircle / DrawLine Ɠ)B
+// _z͎g񂷂̂ŁA`ʂƂ̂ق̓q[vgȂ
+class PrimitiveBatch {
+public:
+	PrimitiveBatch();
+
+	// S centerEa radius ̓hԂ̉~ (͔a猈߂)
+	void AddCircle(const Vec2f& center, float radius, COLOR_U8 color);
+	// a  b ԑ thickness ̐ ([͊ۂ߂Ȃ)
+	void AddLine(const Vec2f& a, const Vec2f& b, float thickness, COLOR_U8 color);
+
+	// ߂Op``ċɂ (܂肷Ƃ Add ̓rł`)
+	void Flush();
+
+	int VertexCount() const { return (int)m_vertices.size(); }
+
+private:
+	// 1 DrawPolygon2D œn_̏
+	static const int MAX_VERTICES = 3 * 16384;
+	// ~̒̕iK (~قǏȂ)
+	static const int SEGMENT_LEVELS = 3;
+	static const int MAX_SEGMENTS = 32;
+
+	// count ̒_ǉł悤ɂāAސԂ
+	VERTEX2D* Reserve(int count);
+
+	std::vector<VERTEX2D> m_vertices;
+	// Ƃ̒Pʉ~̍W (RXgN^ňxvZ)
+	Vec2f m_unitCircle[SEGMENT_LEVELS][MAX_SEGMENTS + 1];
+};
@@ -0,0 +1,231 @@
+#include "ResourceManager.h"
+#include "DxLib.h"
+#include "TextLayoutCache.h"
+#include <cstring>
+
+// --- ResourceRef ---
+
+ResourceRef::ResourceRef(ResourceManager* manager, int index)
+	:m_manager(manager), m_index(index)
+{
+	if (m_manager) m_manager->m_entries[m_index].refCount++;
+}
+
+ResourceRef::ResourceRef(const ResourceRef& other)
+	:ResourceRef(other.m_manager, other.m_index)
+{
+}
+
+ResourceRef& ResourceRef::operator=(const ResourceRef& other) {
+	if (this == &other) return *this;
+	if (other.m_manager) other.m_manager->m_entries[other.m_index].refCount++;
+	if (m_manager) m_manager->m_entries[m_index].refCount--;
+	m_manager = other.m_manager;
+	m_index = other.m_index;
+	return *this;
+}
+
+ResourceRef::~ResourceRef() {
+	if (m_manager) m_manager->m_entries[m_index].refCount--;
+}
+
+void ResourceRef::Reset() {
+	if (m_manager) m_manager->m_entries[m_index].refCount--;
+	m_manager = nullptr;
+	m_index = -1;
+}
+
+int ResourceRef::Handle() const {
+	if (!m_manager) return -1;
+	const ResourceManager::Entry& entry = m_manager->m_entries[m_index];
+	return entry.state == ResourceManager::State::Ready ? entry.handle : -1;
+}
+
+// --- ResourceManager ---
+
+ResourceManager::~ResourceManager() {
+	Finalize();
+}
+
+void ResourceManager::RegisterFont(const char* key, const char* fontFile, const char* fontName, int size, int thick) {
+	//t@C̃tHg͓o^1ōς܂
+	int file = -1;
+	for (int i = 0; i < (int)m_fontFiles.size(); i++) {
+		if (m_fontFiles[i].path == fontFile) file = i;
+	}
+	if (file < 0) {
+		m_fontFiles.push_back({ fontFile });
+		file = (int)m_fontFiles.size() - 1;
+	}
+	Entry entry;
+	entry.key = key;
+	entry.type = Type::Font;
+	entry.fontName = fontName;
+	entry.fontFile = file;
+	entry.size = size;
+	entry.thick = thick;
+	m_entries.push_back(entry);
+}
+
+void ResourceManager::RegisterImage(const char* key, const char* path) {
+	Entry entry;
+	entry.key = key;
+	entry.type = Type::Image;
+	entry.path = path;
+	m_entries.push_back(entry);
+}
+
+void ResourceManager::Initialize() {
+	if (m_loader.joinable()) return;
+	m_stopLoader = false;
+	m_loader = std::thread(&ResourceManager::LoaderMain, this);
+}
+
+void ResourceManager::Finalize() {
+	if (m_loader.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(m_loaderMutex);
+			m_stopLoader = true;
+		}
+		m_loaderWake.notify_one();
+		m_loader.join();
+	}
+	for (Entry& entry : m_entries) Unload(entry);
+	for (FontFile& file : m_fontFiles) {
+		if (file.state == FILE_ADDED) RemoveFontResourceEx(file.path.c_str(), FR_PRIVATE, 0);
+		file.state = FILE_IDLE;
+	}
+}
+
+int ResourceManager::Find(const char* key) const {
+	for (int i = 0; i < (int)m_entries.size(); i++) {
+		if (m_entries[i].key == key) return i;
+	}
+	return -1;
+}
+
+ResourceRef ResourceManager::Acquire(const char* key) {
+	const int index = Find(key);
+	if (index < 0) return ResourceRef();
+	//QƂ炷ǂݍ݂n߂ ( Update ҂Ȃ)
+	Advance(m_entries[index]);
+	return ResourceRef(this, index);
+}
+
+std::vector<ResourceRef> ResourceManager::AcquireAll(const ResourceList& list) {
+	std::vector<ResourceRef> refs;
+	refs.reserve(list.count);
+	for (int i = 0; i < list.count; i++) refs.push_back(Acquire(list.keys[i]));
+	return refs;
+}
+
+void ResourceManager::Update() {
+	for (Entry& entry : m_entries) {
+		if (entry.state == State::WaitingFile || entry.state == State::Loading) Advance(entry);
+	}
+}
+
+void ResourceManager::Advance(Entry& entry) {
+	switch (entry.state) {
+	case State::Unloaded:
+		if (entry.type == Type::Image) {
+			SetUseASyncLoadFlag(TRUE);
+			entry.handle = LoadGraph(entry.path.c_str());
+			SetUseASyncLoadFlag(FALSE);
+			entry.state = (entry.handle == -1) ? State::Failed : State::Loading;
+			return;
+		}
+		//tHg̓t@Co^Ă̂ŁAɓǂݍ݂̃Xbhɗ
+		{
+			std::lock_guard<std::mutex> lock(m_loaderMutex);
+			FontFile& file = m_fontFiles[entry.fontFile];
+			if (file.state == FILE_IDLE) {
+				file.state = FILE_QUEUED;
+				m_fontFileQueue.push_back(entry.fontFile);
+				m_loaderWake.notify_one();
+			}
+		}
+		entry.state = State::WaitingFile;
+		return;
+
+	case State::WaitingFile: {
+		FontFileState fileState;
+		{
+			std::lock_guard<std::mutex> lock(m_loaderMutex);
+			fileState = m_fontFiles[entry.fontFile].state;
+		}
+		if (fileState == FILE_FAILED) {
+			entry.state = State::Failed;
+		}
+		else if (fileState == FILE_ADDED) {
+			SetUseASyncLoadFlag(TRUE);
+			entry.handle = CreateFontToHandle(entry.fontName.c_str(), entry.size, entry.thick);
+			SetUseASyncLoadFlag(FALSE);
+			entry.state = (entry.handle == -1) ? State::Failed : State::Loading;
+		}
+		return;
+	}
+
+	case State::Loading: {
+		//TRUE: ܂ǂݍݒ FALSE: I -1: s
+		const int loading = CheckHandleASyncLoad(entry.handle);
+		if (loading == FALSE) entry.state = State::Ready;
+		else if (loading == -1) entry.state = State::Failed;
+		return;
+	}
+
+	default:
+		return;
+	}
+}
+
+void ResourceManager::Unload(Entry& entry) {
+	if (entry.handle != -1) {
+		if (entry.type == Type::Font) DeleteFontToHandle(entry.handle);
+		else DeleteGraph(entry.handle);
+	}
+	entry.handle = -1;
+	//t@C̓o^͎ĉŁAɎgƂ̓tHgƂ납n܂
+	entry.state = State::Unloaded;
+}
+
+void ResourceManager::ReleaseUnused() {
+	bool fontReleased = false;
+	for (Entry& entry : m_entries) {
+		if (entry.refCount > 0 || entry.state == State::Unloaded) continue;
+		//t@C̓o^҂ĂԂ͂܂nhȂ
+		if (entry.state == State::WaitingFile) {
+			entry.state = State::Unloaded;
+			continue;
+		}
+		fontReleased |= (entry.type == Type::Font && entry.handle != -1);
+		Unload(entry);
+	}
+	//l̃nhʂ̃tHgɎg񂳂邱Ƃ̂ŁA傫̂Ă
+	if (fontReleased) TextLayoutCache::Clear();
+}
+
+int ResourceManager::LoadingCount() const {
+	int count = 0;
+	for (const Entry& entry : m_entries) {
+		if (entry.state == State::WaitingFile || entry.state == State::Loading) count++;
+	}
+	return count;
+}
+
+void ResourceManager::LoaderMain() {
+	std::unique_lock<std::mutex> lock(m_loaderMutex);
+	for (;;) {
+		m_loaderWake.wait(lock, [this] { return m_stopLoader || !m_fontFileQueue.empty(); });
+		if (m_stopLoader) return;
+		const int index = m_fontFileQueue.back();
+		m_fontFileQueue.pop_back();
+		const std::string path = m_fontFiles[index].path;
+
+		//t@C̓ǂݍ݂Ɖ͂ɎԂ̂ŁAbNOēo^
+		lock.unlock();
+		const bool added = AddFontResourceEx(path.c_str(), FR_PRIVATE, 0) > 0;
+		lock.lock();
+		m_fontFiles[index].state = added ? FILE_ADDED : FILE_FAILED;
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ResourceManager;
+
+// ResourceManager tHgE摜ւ̎Q
+// Rs[ƎQƂAjƌBQƂȂȂĂA ReleaseUnused ܂ł͎c
+class ResourceRef {
+public:
+	ResourceRef() = default;
+	ResourceRef(const ResourceRef& other);
+	ResourceRef& operator=(const ResourceRef& other);
+	~ResourceRef();
+
+	// ǂݍ݂IĂ DxLib ̃nhA܂Ȃ -1
+	// (DxLib ͓ǂݍݒ̃nh`ɎgƏI܂ő҂̂ŁAgOɊm߂)
+	int Handle() const;
+	bool IsReady() const { return Handle() != -1; }
+	// QƂ (ĂV[ Terminate ŌĂ)
+	void Reset();
+
+private:
+	friend class ResourceManager;
+	ResourceRef(ResourceManager* manager, int index);
+
+	ResourceManager* m_manager = nullptr;
+	int m_index = -1;
+};
+
+// V[g̃L[̕ (JڂÕV[ AcquireAll œǂݎn߂Ă)
+struct ResourceList {
+	const char* const* keys;
+	int count;
+};
+
+// tHgƉ摜L[ŋLAQƂ̐𐔂ĊǗ
+// ǂݍ݂͗Ői߂: tHgt@C̓o^ (AddFontResourceEx) ͐p̃XbhŁA
+// tHgnhƉ摜 DxLib ̔񓯊ǂݍ (SetUseASyncLoadFlag) ōB
+// V[ Init  Acquire Aǂݍݒ̊Ԃ IsReady  false ̂܂ܕ`΂B
+// AcquireEQƂ̃Rs[ƔjEUpdate  DxLib ƓCXbh炾ĂԂ
+class ResourceManager {
+public:
+	ResourceManager() = default;
+	~ResourceManager();
+
+	ResourceManager(const ResourceManager&) = delete;
+	ResourceManager& operator=(const ResourceManager&) = delete;
+
+	// fontFile o^ĂAfontName ̃tHg size, thick ō
+	void RegisterFont(const char* key, const char* fontFile, const char* fontName, int size, int thick);
+	void RegisterImage(const char* key, const char* path);
+
+	// ǂݍ݂̃Xbh𓮂 (DxLib_Init ̌)
+	void Initialize();
+	// ׂĉāAo^tHgt@CO (DxLib_End ̑O)
+	void Finalize();
+
+	// key ̎̎Q (܂ǂݍłȂΓǂݍ݂n߂)
+	ResourceRef Acquire(const char* key);
+	std::vector<ResourceRef> AcquireAll(const ResourceList& list);
+
+	// t[ĂԁBŏIǂݍ݂g悤ɂA̒iKɐi߂
+	void Update();
+	// QƂȂȂ̂ (JڂAVV[ Acquire ĂĂ)
+	void ReleaseUnused();
+
+	// ǂݍݒ̐ ([h̕\p)
+	int LoadingCount() const;
+
+private:
+	friend class ResourceRef;
+
+	enum class Type { Font, Image };
+	enum class State { Unloaded, WaitingFile, Loading, Ready, Failed };
+
+	struct Entry {
+		std::string key;
+		Type type;
+		std::string path;		// 摜̃pX
+		std::string fontName;
+		int fontFile = -1;		// m_fontFiles ̃CfbNX
+		int size = 0;
+		int thick = 0;
+		int handle = -1;
+		int refCount = 0;
+		State state = State::Unloaded;
+	};
+
+	// tHgt@C̓o^ (ǂݍ݂̃Xbhi߂)
+	enum FontFileState { FILE_IDLE, FILE_QUEUED, FILE_ADDED, FILE_FAILED };
+	struct FontFile {
+		std::string path;
+		FontFileState state = FILE_IDLE;	// m_loaderMutex Ŏ
+	};
+
+	int Find(const char* key) const;
+	// QƂƂɓǂݍ݂n߂ / i߂
+	void Advance(Entry& entry);
+	void Unload(Entry& entry);
+	void LoaderMain();
+
+	std::vector<Entry> m_entries;
+	std::vector<FontFile> m_fontFiles;
+
+	std::thread m_loader;
+	std::mutex m_loaderMutex;
+	std::condition_variable m_loaderWake;
+	std::vector<int> m_fontFileQueue;
+	bool m_stopLoader = false;
+};
@@ -2,33 +2,44 @@
 #include "DxLib.h"
 #include "ResultState.h"
 
+namespace {
+	const char* const RESOURCE_KEYS[] = { "font.result" };
+}
+
+const ResourceList ResultState::RESOURCES = { RESOURCE_KEYS, sizeof(RESOURCE_KEYS) / sizeof(RESOURCE_KEYS[0]) };
+
 void ResultState::Init() {
 	//lXȂ̂̃[h
 	SetBackgroundColor(255, 255, 255);
-	//gp̃p\RɈꎞIFontǂݍ܂
-	AddFontResourceEx("Data/YDWaosagi.otf", FR_PRIVATE, 0);
-	m_resultFontHandle = CreateFontToHandle("YDW  R", 30, 5);
+	ResourceManager& resources = m_gameManager->Resources();
+	m_resultFont = resources.Acquire("font.result");
+	m_preload = resources.AcquireAll(InGameState::RESOURCES);
 }
 
-SceneTransition* ResultState::Update(const InputState* input, float deltaTime) {
+SceneTransition ResultState::Update(const InputState* input, float deltaTime, const FrameContext& frame) {
 	//SpaceƂ̓Q[V[ֈڍs
 	if (input->IsKeyDown(KEY_INPUT_SPACE)) {
-		SceneTransition* trans = new SceneTransition{ TransitionType::Change,
-			std::make_unique<InGameState>(m_gameManager) };
-		return trans;
+		return SceneTransition::ChangeTo(SceneId::InGame);
 	}
 
-	SceneTransition* trans = new SceneTransition{ TransitionType::None, nullptr };
-	return trans;
+	return {};
 }
 
 void ResultState::Draw() {
-	GameData::DrawStringWithAnchor(50, 100, 0, 0.5f,
-		GetColor(0, 0, 0), m_resultFontHandle, "Escape : terminate game");
+	//tHg̓ǂݍ݂I܂ł͕oȂ
+	if (!m_resultFont.IsReady()) return;
+	GameData::DrawStaticStringWithAnchor(50, 100, 0, 0.5f,
+		GetColor(0, 0, 0), m_resultFont.Handle(), "Escape : terminate game");
 }
 
 void ResultState::Terminate() {
 	//lXȂ̂̃A[h
-	//ǂݍ܂tHgJ
-	RemoveFontResourceEx("Data/YDWaosagi.otf", FR_PRIVATE, 0);
-}
\ No newline at end of file
+	m_resultFont.Reset();
+	m_preload.clear();
+}
+
+int ResultState::Successors(SceneId* out, int maxCount) const {
+	if (maxCount < 1) return 0;
+	out[0] = SceneId::InGame;
+	return 1;
+}
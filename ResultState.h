@@ -1,6 +1,8 @@
 #pragma once
 #include "IGameState.h"
 #include "InGameState.h"
+#include "ResourceManager.h"
+#include <vector>
 
 class GameManager;
 
@@ -10,10 +12,18 @@ public:
 	~ResultState() override = default;
 
 	void Init()override;
-	SceneTransition* Update(const InputState* input, float deltaTime)override;
+	SceneTransition Update(const InputState* input, float deltaTime, const FrameContext& frame)override;
 	void Draw()override;
 	void Terminate()override;
 
+	SceneId Id() const override { return SceneId::Result; }
+	int Successors(SceneId* out, int maxCount) const override;
+	bool KeepWarm() const override { return true; }
+
+	//̃V[ŎgtHgƉ摜 (JڂÕV[ɓǂݎn߂Ă)
+	static const ResourceList RESOURCES;
+
 private:
-	int m_resultFontHandle;
+	ResourceRef m_resultFont;
+	std::vector<ResourceRef> m_preload;		// InGameState Ŏg
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "SimulationThread.h"
+#include "IGameState.h"
+#include "GameData.h"
+#include "PhysicsCore/Profiler.h"
+#include <chrono>
+
+SimulationThread::~SimulationThread() {
+	Stop();
+}
+
+void SimulationThread::Start() {
+	if (IsRunning()) return;
+	m_stopRequested.store(false, std::memory_order_relaxed);
+	m_thread = std::thread(&SimulationThread::Run, this);
+}
+
+void SimulationThread::Stop() {
+	if (!IsRunning()) return;
+	m_stopRequested.store(true, std::memory_order_relaxed);
+	m_thread.join();
+	//~߂ĂԂɃV[j邱Ƃ̂ŁA Start  SetScene ܂Ői߂Ȃ
+	m_scene = nullptr;
+}
+
+void SimulationThread::SetKeys(const KeyBits& keys) {
+	std::lock_guard<std::mutex> lock(m_keysMutex);
+	m_keys = keys;
+}
+
+void SimulationThread::Run() {
+	Profiler::SetThreadName("Simulation");
+	using Clock = std::chrono::steady_clock;
+	const float fixedDeltaTime = 1.0f / GameData::physicsRate;
+	const Clock::duration stepDuration = std::chrono::duration_cast<Clock::duration>(
+		std::chrono::duration<double>(1.0 / GameData::physicsRate));
+
+	//̃Xebvi߂鎞Bɒǂ܂ŌŒ蕝Ői߂
+	Clock::time_point next = Clock::now();
+	while (!m_stopRequested.load(std::memory_order_relaxed)) {
+		const Clock::time_point now = Clock::now();
+		if (now < next) {
+			std::this_thread::sleep_until(next);
+			continue;
+		}
+		//ŗ܂肷͎̂Ă (GameManager::ConsumeFixedSteps Ɠ)
+		const int behind = (int)((now - next) / stepDuration);
+		if (behind >= GameData::maxSubSteps) {
+			m_droppedSteps.fetch_add(behind - GameData::maxSubSteps + 1, std::memory_order_relaxed);
+			next += stepDuration * (behind - GameData::maxSubSteps + 1);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_sceneMutex);
+			Step(fixedDeltaTime);
+		}
+		next += stepDuration;
+	}
+}
+
+void SimulationThread::Step(float fixedDeltaTime) {
+	PROFILE_SCOPE("Simulation::Step");
+	if (m_scene == nullptr) return;
+
+	KeyBits keys;
+	{
+		std::lock_guard<std::mutex> lock(m_keysMutex);
+		keys = m_keys;
+	}
+	m_clock += fixedDeltaTime;
+	m_input.Advance(keys, m_clock);
+
+	m_arena.Reset();
+	m_frame.arena = &m_arena;
+	m_frame.frameNumber++;
+	m_scene->FixedUpdate(&m_input, fixedDeltaTime, m_frame);
+}
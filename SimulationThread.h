@@ -0,0 +1,57 @@
+#pragma once
+#include "InputState.h"
+#include "PhysicsCore/FrameArena.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+class IGameState;
+
+// V[̌ŒXebv (FixedUpdate) A`Ƃ͕ʂ̃Xbh physicsRate /bi߂
+// `摤̓[h PublishSnapshot XibvVbgǂނ̂ŁA
+// ScreenFlip ̐҂ŃXebvx邱ƂAdXebvŕ`̃t[邱ƂȂB
+// V[ Update ƑJڂ̓CXbh Pause() ̃bNčs (̊ԃXebv͎~܂)
+class SimulationThread {
+public:
+	SimulationThread() = default;
+	~SimulationThread();
+
+	SimulationThread(const SimulationThread&) = delete;
+	SimulationThread& operator=(const SimulationThread&) = delete;
+
+	void Start();
+	// i߂Ăr̃XebvÎ҂Ď~߂
+	void Stop();
+	bool IsRunning() const { return m_thread.joinable(); }
+
+	// ԂbNĂԂ̓Xebvi߂Ȃ
+	std::unique_lock<std::mutex> Pause() { return std::unique_lock<std::mutex>(m_sceneMutex); }
+	// Xebvi߂V[ (Pause ̃bNČĂԁBnullptr Ȃi߂Ȃ)
+	void SetScene(IGameState* scene) { m_scene = scene; }
+	// CXbhǂ񂾃L[ (̃Xebvg)
+	void SetKeys(const KeyBits& keys);
+
+	// xꂪ܂肷Ď̂ĂXebv̐ (NĂ̍v)
+	unsigned int DroppedSteps() const { return m_droppedSteps.load(std::memory_order_relaxed); }
+
+private:
+	void Run();
+	// 1Xebvi߂ (m_sceneMutex ČĂ)
+	void Step(float fixedDeltaTime);
+
+	std::thread m_thread;
+	std::atomic<bool> m_stopRequested{ false };
+	std::atomic<unsigned int> m_droppedSteps{ 0 };
+
+	std::mutex m_sceneMutex;
+	IGameState* m_scene = nullptr;
+
+	std::mutex m_keysMutex;
+	KeyBits m_keys;
+
+	// 牺̓V~[ṼXbhG
+	InputState m_input;			// XebvƂɐi߂ (uԂ͂傤1Xebv)
+	double m_clock = 0;			// i߂Xebv̍v (̓Cxg̎, b)
+	FrameArena m_arena;			// 1XebvgƗp
+	FrameContext m_frame;
+};
@@ -1,80 +1,32 @@
 #include "SpringAndGravityManager.h"
-
-SpringAndGravityManager::SpringAndGravityManager() {
-	InitializeSpring();
-}
+#include "InputBinding.h"
 
 void SpringAndGravityManager::Update(const InputState* input, float deltaTime) {
-	// O̗͂̓Kp (L[)
-	ApplyExternalForce();
-
-	// 1. ψ (R̐Lт܂͏k) vZ
-	// ݂̒: lowerPoint.y - FIXED_Y
-	// L x ́A݂̒ - RBiY+jLт̐B
-	double currentLength = lowerPoint.y - FIXED_Y;
-	double x = currentLength - NATURAL_LENGTH;
-
-	// 2. ol̗ (tbN̖@: F_spring = -k * x)
-	// L(x>0)̏ꍇAF_spring͏iY-jɂȂ邽߁A̓}CiXB
-	double F_spring = -SPRING_CONSTANT * x;
-
-	// 3.  (R: F_damp = -d * v)
-	// xƋt
-	double F_damp = -DAMPING_CONSTANT * lowerPoint.v;
-
-	// 4. d (F_gravity = M * G)
-	// d͂͏ɉiYjɓ
-	double F_gravity = MASS * GRAVITY_ACCEL;
-
-	// 5.  (F = F_spring + F_damp + F_gravity + F_external)
-	// F_external (L[)  ApplyExternalForce ֐ŉxɓKpς݂Ƃ
-	double F_net = F_spring + F_damp + F_gravity;
-
-	// 6. j[g̉^ (a = F / m)
-	// F_net pĉxXV
-	lowerPoint.a += F_net / MASS;
-
-	// 7. xƈʒu̍XV (IC[@)
-	lowerPoint.v += lowerPoint.a * deltaTime;
-	lowerPoint.y += lowerPoint.v * deltaTime;
-
-	// 8. x̃Zbgĩt[̍͌vZɔj
-	lowerPoint.a = 0.0;
+	// W/S ͉uԂ͂
+	core->SetControl(MakeBodyControlImmediate(input));
 }
 
-void SpringAndGravityManager::Draw() {
+void SpringAndGravityManager::Draw(const WorldSnapshot& snapshot, float alpha) {
+	const SnapshotBody* body = snapshot.Find(core);
+	if (body == nullptr) return;
+	const int FIXED_X = core->FixedX();
+	const int FIXED_Y = core->FixedY();
+	// ̎_ (RA̒l̓V~[ṼXbhĂ̂ŁAXibvVbgǂ)
+	const double lowerY = snapshot.Interpolated(*body, 0, alpha).y;
+
 	const int RADIUS = 10;
 
 	// 㑤̌Œ_iԐFj
 	DrawCircle(FIXED_X, FIXED_Y, RADIUS, GetColor(255, 0, 0), TRUE);
 
 	// ̓_iFj
-	DrawCircle(FIXED_X, (int)lowerPoint.y, RADIUS, GetColor(0, 0, 255), TRUE);
+	DrawCircle(FIXED_X, (int)lowerY, RADIUS, GetColor(0, 0, 255), TRUE);
 
 	// oliΐF̒ƂĊȈՓIɕ`j
-	DrawLine(FIXED_X, FIXED_Y + RADIUS, FIXED_X, (int)lowerPoint.y - RADIUS, GetColor(0, 255, 0));
+	DrawLine(FIXED_X, FIXED_Y + RADIUS, FIXED_X, (int)lowerY - RADIUS, GetColor(0, 255, 0));
 
 	// \
 	DrawFormatString(10, 10, GetColor(255, 255, 255), "W/SL[ŏ㉺ɗ͂");
-	DrawFormatString(10, 30, GetColor(255, 255, 255), "Yʒu: %.2f", lowerPoint.y);
-	DrawFormatString(10, 50, GetColor(255, 255, 255), "xV: %.2f", lowerPoint.v);
+	DrawFormatString(10, 30, GetColor(255, 255, 255), "Yʒu: %.2f", lowerY);
+	DrawFormatString(10, 50, GetColor(255, 255, 255), "xV: %.2f", snapshot.Point(*body, 0).velocity.y);
 }
-
-void SpringAndGravityManager::InitializeSpring() {
-	// ʒuR̈ʒuɐݒ
-	lowerPoint.y = (double)FIXED_Y + NATURAL_LENGTH;
-	lowerPoint.v = 0.0;
-	lowerPoint.a = 0.0;
-}
-
-void SpringAndGravityManager::ApplyExternalForce() {
-	// WL[ŏ֗͂iYj
-	if (CheckHitKey(KEY_INPUT_W)) {
-		lowerPoint.a -= EXTERNAL_ACCEL;
-	}
-	// SL[ŉ֗͂iYj
-	if (CheckHitKey(KEY_INPUT_S)) {
-		lowerPoint.a += EXTERNAL_ACCEL;
-	}
-	// D/AL[͍̏폜
-}
\ No newline at end of file
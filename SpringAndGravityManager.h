@@ -1,44 +1,20 @@
 #pragma once
 #include "DxLib.h"
 #include "InputState.h"
+#include "PhysicsCore/SpringGravityCore.h"
+#include "PhysicsCore/PhysicsWorld.h"
 
+// SpringGravityCore ̕`A_v^ (vZ PhysicsCore )
+// RA PhysicsWorld AXebv PhysicsWorld::Step Ői߂
 class SpringAndGravityManager {
 public:
-	SpringAndGravityManager();
+	SpringAndGravityManager(PhysicsWorld& world) :core(world.CreateBody<SpringGravityCore>()) {}
 	~SpringAndGravityManager() {}
 
+	// ͂RAɓn (Xebv PhysicsWorld::Step Ői߂)
 	void Update(const InputState* input, float deltaTime);
-	void Draw();
+	// snapshot: `[h̏ alpha: O̕Xebv̕ԗ (0`1)
+	void Draw(const WorldSnapshot& snapshot, float alpha = 1.0f);
 private:
-
-	// --- ֐vg^Cv錾 ---
-	void InitializeSpring();
-	void ApplyExternalForce(); // W/SL[̗͂Kp
-
-	// --- 萔` ---
-	const double MASS = 1.0;
-	const double SPRING_CONSTANT = 5.0;
-	const double DAMPING_CONSTANT = 0.5;
-	// ol̎R (pixels)
-	const int NATURAL_LENGTH = 150;
-	// d͉x (pixels/s^2) - `ɍ킹đ傫߂ɐݒ
-	const double GRAVITY_ACCEL = 9.8 * 50;
-
-	// Œ|Cg̍Wi㑤j
-	const int FIXED_X = 320;
-	const int FIXED_Y = 100;
-
-	// O̗͂̋ixƂĕ\j
-	const double EXTERNAL_ACCEL = 500.0;
-
-	// --- _\ (Y̓ɓ) ---
-	struct Point {
-		double y; // Yʒu
-		double v; // x
-		double a; // x
-	};
-
-	// --- O[oϐ ---
-	Point lowerPoint;
-
+	SpringGravityCore* core; // PhysicsWorld 
 };
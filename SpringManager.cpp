@@ -1,45 +1,19 @@
 #include "SpringManager.h"
-
-SpringManager::SpringManager() {
-	InitializeSpring();
-}
+#include "InputBinding.h"
 
 void SpringManager::Update(const InputState* input, float deltaTime) {
-	//͏ƏԂ̐؂ւ
-	//HandleInput();
-
-	if (!isSimulationActive)return;
-
-	ApplyExternalForce(input);
-
-	// 1. ψ (R̐Lт܂͏k) vZ
-	// ψ x ́A݂̒ - R
-	double currentLength = rightPoint.x - FIXED_X;
-	double x = currentLength - NATURAL_LENGTH;
-
-	// 2. ol̗ (tbN̖@: F_spring = -k * x)
-	double F_spring = -SPRING_CONSTANT * x;
-
-	// 3.  (R: F_damp = -d * v)
-	double F_damp = -DAMPING_CONSTANT * rightPoint.v;
-
-	// 4.  (F = F_spring + F_damp + F_external)
-	// O̗ (F_external)  ApplyExternalForce ֐ŉxɓKpς݂Ƃ
-	double F_net = F_spring + F_damp;
-
-	// 5. j[g̉^ (a = F / m)
-	// F_net pĉxXV
-	rightPoint.a += F_net / MASS;
-
-	// 6. xƈʒu̍XV (IC[@)
-	rightPoint.v += rightPoint.a * deltaTime;
-	rightPoint.x += rightPoint.v * deltaTime;
-
-	// 7. x̃Zbgĩt[̍͌vZɔj
-	rightPoint.a = 0.0;
+	core->SetControl(MakeBodyControl(input));
 }
 
-void SpringManager::Draw() {
+void SpringManager::Draw(const WorldSnapshot& snapshot, float alpha) {
+	const SnapshotBody* body = snapshot.Find(core);
+	if (body == nullptr) return;
+	const int FIXED_X = core->FixedX();
+	const int FIXED_Y = core->FixedY();
+	// E̎_ (RA̒l̓V~[ṼXbhĂ̂ŁAXibvVbgǂ)
+	const SnapshotPoint& rightPoint = snapshot.Point(*body, 0);
+	const double rightX = snapshot.Interpolated(*body, 0, alpha).x;
+
 	// _̔a
 	const int RADIUS = 10;
 
@@ -47,85 +21,13 @@ void SpringManager::Draw() {
 	DrawCircle(FIXED_X, FIXED_Y, RADIUS, GetColor(255, 0, 0), TRUE);
 
 	// E̓_iFj
-	DrawCircle((int)rightPoint.x, FIXED_Y, RADIUS, GetColor(0, 0, 255), TRUE);
+	DrawCircle((int)rightX, FIXED_Y, RADIUS, GetColor(0, 0, 255), TRUE);
 
 	// oliΐF̒ƂĊȈՓIɕ`j
-	DrawLine(FIXED_X + RADIUS, FIXED_Y, (int)rightPoint.x - RADIUS, FIXED_Y, GetColor(0, 255, 0));
+	DrawLine(FIXED_X + RADIUS, FIXED_Y, (int)rightX - RADIUS, FIXED_Y, GetColor(0, 255, 0));
 
 	// \
 	DrawFormatString(10, 10, GetColor(255, 255, 255), "A/DL[ŗ͂");
-	DrawFormatString(10, 30, GetColor(255, 255, 255), "Xʒu: %.2f", rightPoint.x);
-	DrawFormatString(10, 50, GetColor(255, 255, 255), "xV: %.2f", rightPoint.v);
-}
-
-void SpringManager::InitializeSpring() {
-	rightPoint.x = (double)FIXED_X + NATURAL_LENGTH + INITIAL_X_OFFSET; // R+ItZbg
-	rightPoint.v = 0.0;
-	rightPoint.a = 0.0;
+	DrawFormatString(10, 30, GetColor(255, 255, 255), "Xʒu: %.2f", rightPoint.current.x);
+	DrawFormatString(10, 50, GetColor(255, 255, 255), "xV: %.2f", rightPoint.velocity.x);
 }
-
-void SpringManager::ApplyExternalForce(const InputState* input) {
-	// O̗͂ɂĉx𒼐ډ
-	const double EXTERNAL_ACCEL = 500.0; // O̗͂̋ixƂĕ\j
-
-	// DL[ŉE֗͂
-	if (input->IsKeyStay(KEY_INPUT_D)) {
-		rightPoint.a += EXTERNAL_ACCEL;
-	}
-	// AL[ō֗͂
-	if (input->IsKeyStay(KEY_INPUT_A)) {
-		rightPoint.a -= EXTERNAL_ACCEL;
-	}
-}
-
-// --- ͏ƏԂ̐؂ւAʒűړs֐ ---
-void SpringManager::HandleInput() {
-	int MouseX, MouseY;
-	GetMousePoint(&MouseX, &MouseY);
-	int mouseInput = GetMouseInput();
-	bool isLClick = (mouseInput & MOUSE_INPUT_LEFT) != 0;
-
-	bool isKeyActive = CheckHitKey(KEY_INPUT_D) || CheckHitKey(KEY_INPUT_A);
-
-	// --- Dx1: }EX ---
-	if (isLClick) {
-		isSimulationActive = false; // V~[V~
-
-		// ʒu}EXXWɋݒ
-		rightPoint.x = (double)MouseX;
-
-		// xƉxZbgi𗣂uԂɐÎ~Ԃ瓮o߁j
-		rightPoint.v = 0.0;
-		rightPoint.a = 0.0;
-
-		// --- Dx2: A/DL[ ---
-	}
-	else if (isKeyActive) {
-		isSimulationActive = false; // V~[V~
-
-		// L[UpdateSpringĂ΂Ȃ߁Å֐Œڎ_𓮂
-
-		// xƉxZbgiL[uԂɑO̊j
-		//  cꍇ͂̃Zbg폜
-		rightPoint.v = 0.0;
-		rightPoint.a = 0.0;
-
-		// ꂽL[ɉĉxKp
-		if (CheckHitKey(KEY_INPUT_D)) {
-			rightPoint.a += EXTERNAL_ACCEL;
-		}
-		if (CheckHitKey(KEY_INPUT_A)) {
-			rightPoint.a -= EXTERNAL_ACCEL;
-		}
-
-		// xɂʒuƑx̍XV
-		rightPoint.v += rightPoint.a * DELTA_TIME;
-		rightPoint.x += rightPoint.v * DELTA_TIME;
-
-		// --- Dx3: Ȃ ---
-	}
-	else {
-		// }EXL[ĂȂꍇAV~[VĊJ
-		isSimulationActive = true;
-	}
-}
\ No newline at end of file
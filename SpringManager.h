@@ -1,54 +1,21 @@
 #pragma once
 #include "DxLib.h"
 #include "InputState.h"
+#include "PhysicsCore/SpringCore.h"
+#include "PhysicsCore/PhysicsWorld.h"
 
-// --- _\ ---
-struct Point {
-	double x; // ʒu
-	double v; // x
-	double a; // x
-};
-
+// SpringCore ̕`A_v^ (vZ PhysicsCore )
+// RA PhysicsWorld AXebv PhysicsWorld::Step Ői߂
 class SpringManager {
 public:
-	SpringManager();
+	SpringManager(PhysicsWorld& world) :core(world.CreateBody<SpringCore>()) {}
 	~SpringManager() {}
 
+	// ͂RAɓn (Xebv PhysicsWorld::Step Ői߂)
 	void Update(const InputState* input, float deltaTime);
-	void Draw();
+	// snapshot: `[h̏ alpha: O̕Xebv̕ԗ (0`1)
+	void Draw(const WorldSnapshot& snapshot, float alpha = 1.0f);
 
 private:
-	// --- ֐vg^Cv錾 ---
-	void InitializeSpring();
-	void ApplyExternalForce(const InputState* input);
-	// --- ͏ƏԂ̐؂ւAʒűړs֐ ---
-	void HandleInput();
-
-	// --- O[oϐ ---
-	Point rightPoint;
-
-	// --- 萔` ---
-// ʂ̑傫 (kg)
-	const float MASS = 1.0f;
-	// ΂˒萔 (N/m)
-	const float SPRING_CONSTANT = 10.0f;
-	// 萔 (CRȂǂV~[g)
-	const float DAMPING_CONSTANT = 1.0f;
-	// ol̎R (pixels)
-	const int NATURAL_LENGTH = 200;
-
-	// Œ|Cg̍W
-	const int FIXED_X = 100;
-	const int FIXED_Y = 200;
-
-	// ʒũItZbgiR̈ʒuj
-	const int INITIAL_X_OFFSET = 0;
-
-	// ǉFV~[V̏ԂǗtO
-	bool isSimulationActive = true;
-
-	// O̗͂̋ixƂĕ\j
-	const float EXTERNAL_ACCEL = 1000.0f;
-	// Z̍ݎ
-	const float DELTA_TIME = 0.01f;
-};
\ No newline at end of file
+	SpringCore* core; // PhysicsWorld 
+};
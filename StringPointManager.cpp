@@ -0,0 +1,6 @@
+#include "StringPointManager.h"
+#include "InputBinding.h"
+
+void StringPointManager::Update(const InputState* input) {
+	core->SetControl(MakeBodyControlImmediate(input));
+}
@@ -1,198 +1,74 @@
 #pragma once
 #include "DxLib.h"
-#include <cmath>
+#include "InputState.h"
+#include "PrimitiveBatch.h"
+#include "PhysicsCore/RopeCore.h"
+#include "PhysicsCore/PhysicsWorld.h"
 #include <vector>
 
-// 2xNg/W\
-struct Vec2f {
-	float x;
-	float y;
-
-	// Iy[^[I[o[[h (vZȗ)
-	Vec2f operator+(const Vec2f& other) const { return { x + other.x, y + other.y }; }
-	Vec2f operator-(const Vec2f& other) const { return { x - other.x, y - other.y }; }
-	Vec2f operator*(float scalar) const { return { x * scalar, y * scalar }; }
-	// Iy[^[I[o[[h (xNg̒)
-	float lengthSq() const { return x * x + y * y; }
-	float length() const { return std::sqrt(lengthSq()); }
-};
-
-
+// RopeCore ̕`A_v^ (vZ PhysicsCore )
+// RA PhysicsWorld AXebv PhysicsWorld::Step Ői߂
 class StringPointManager {
 private:
-	std::vector<Vec2f> ropeNodes; // R\m[hQ
-
-	float segmentLength;      // eZOgim[hԁj̗zIȒ
-	float maxStretchDistance; // RŜ̐LтE (Node 0  Node N ̊Ԃ̋)
-	float moveSpeed;          // m[h 0 (_) ̈ړx
-	const int CONSTRAINT_ITERATIONS = 3; // S̔ (قǈ)
+	RopeCore* core; // PhysicsWorld 
 
-	unsigned int lineColor;
-	unsigned int controllableColor;
-	unsigned int fixedColor;
+	COLOR_U8 lineColor;
+	COLOR_U8 controllableColor;
+	COLOR_U8 fixedColor;
 	int pointRadius;
 
 public:
 	/**
 	 * @brief RXgN^
+	 * @param world R郏[h
 	 * @param startX, startY W
 	 * @param nodeCount R̐߂̐ (2_܂ށAŏ2)
 	 * @param segLen e߂̒
 	 * @param maxDist RŜ̌E
-	 * @param speed _̈ړx
+	 * @param speed _̈ړx (1b̈ړ)
 	 */
-	StringPointManager(float startX, float startY, int nodeCount, float segLen, float maxDist, float speed)
-		: segmentLength(segLen), maxStretchDistance(maxDist), moveSpeed(speed)
+	StringPointManager(PhysicsWorld& world, float startX, float startY, int nodeCount, float segLen, float maxDist, float speed)
+		: core(world.CreateBody<RopeCore>(startX, startY, nodeCount, segLen, maxDist, speed))
 	{
-		if (nodeCount < 2) nodeCount = 2;
-
-		// m[hʒu (ɔzu) ɐݒ
-		for (int i = 0; i < nodeCount; ++i) {
-			ropeNodes.push_back({ startX, startY + (float)i * segLen });
-		}
-
 		// Fƕ`ݒ
-		lineColor = GetColor(255, 255, 255);
-		controllableColor = GetColor(0, 255, 0); // Node 0
-		fixedColor = GetColor(255, 0, 0);       // Node N
+		lineColor = GetColorU8(255, 255, 255, 255);
+		controllableColor = GetColorU8(0, 255, 0, 255); // Node 0
+		fixedColor = GetColorU8(255, 0, 0, 255);       // Node N
 		pointRadius = 10;
 	}
 
-	void Update() {
-		handleInputAndUpdateControllablePoint();
-		updateRope();
-	}
-
-	/**
-	 * @brief WASDL[͂ɂm[h 0 (_) ̈ʒuXV
-	 */
-	void handleInputAndUpdateControllablePoint() {
-		// Node 0 ̓[U[삷|Cg
-		Vec2f& controllablePoint = ropeNodes[0];
-
-		// ̈ړ
-		if (CheckHitKey(KEY_INPUT_A)) {
-			controllablePoint.x -= moveSpeed;
-		}
-		if (CheckHitKey(KEY_INPUT_D)) {
-			controllablePoint.x += moveSpeed;
-		}
-
-		// ̈ړ
-		if (CheckHitKey(KEY_INPUT_W)) {
-			controllablePoint.y -= moveSpeed;
-		}
-		if (CheckHitKey(KEY_INPUT_S)) {
-			controllablePoint.y += moveSpeed;
-		}
-
-		// (ʋE͏ȗ)
-	}
-
-	/**
-	 * @brief RŜ̓ƍSXV܂
-	 */
-	void updateRope() {
-		if (ropeNodes.empty()) return;
-
-		// Node 0 (_) ̈ʒu
-		Vec2f& controllablePoint = ropeNodes[0];
-		// Node N (Ǐ]_A) ̈ʒu
-		Vec2f& lastFixedPoint = ropeNodes.back();
-		const int N = ropeNodes.size() - 1;
-
-		// ----------------------------------------------------
-		// tF[Y 1: RŜ̃O[oȍS`FbN (̃WbN)
-		// ----------------------------------------------------
-
-		// Node 0  Node N ̊Ԃ̋`FbN
-		float totalDistance = (controllablePoint - lastFixedPoint).length();
-		bool isRopeTaut = (totalDistance > maxStretchDistance);
-
-		if (isRopeTaut) {
-			// RLтE𒴂ꍇANode N  Node 0 ËʒuɈړ
-			Vec2f direction = normalize(lastFixedPoint - controllablePoint);
-			lastFixedPoint = controllablePoint + direction * maxStretchDistance;
-		}
-
-		// ----------------------------------------------------
-		// tF[Y 2: m[hԂ̃ZOgS (/Ǐ]̃V~[V)
-		// ----------------------------------------------------
-
-		// S𕡐񔽕邱Ƃň肵 (Position-Based Dynamics̊ȈՔ)
-		for (int k = 0; k < CONSTRAINT_ITERATIONS; ++k) {
-
-			// S Node 1  Node N ܂ōs
-			for (int i = 1; i <= N; ++i) {
-				// p1 (Node i)  p2 (Node i-1) ̊Ԃŏ
-				Vec2f& p1 = ropeNodes[i];
-				Vec2f& p2 = ropeNodes[i - 1];
-
-				Vec2f diff = p1 - p2;
-				float currentDist = diff.length();
-
-				// C (ǂꂾ΃ZOgɂȂ邩)
-				float correctionFactor = (currentDist - segmentLength) / currentDist;
-				Vec2f correctionVector = diff * correctionFactor;
-
-				// 1. Node i (p1) ̈ړ:
-				// Node N bNĂԂ́ANode N ͓Ȃ߁A
-				// ̃m[h (i=N) ́AŜ̍SĂȂ蓮܂B
-				// APhase 1  Node N ̈ʒu͊ɋCĂ邽߁A
-				// ł Node N ƂA̓ Node N-1 ɓ`d܂B
-
-				// Node 0 ̓[U[͂ŌŒ肳Ă邽߁AׂĂ̏C p1 ɗ^
-				if (i == 1) {
-					p1 = p1 - correctionVector;
-				}
-				// ȊÕm[h́Ap1  p2 ̗ɏC𕪊
-				else {
-					p1 = p1 - correctionVector * 0.5f;
-					// p2  Node 0 ȊOłΓ
-					p2 = p2 + correctionVector * 0.5f;
-				}
-			}
-
-			// dv: Node 0 ̓[U[ɂđ삳ꂽʒuɁA
-			// Node N ̓O[oSɂďCꂽʒuɁAꂼꃊZbg
-			ropeNodes[0] = controllablePoint;
-			if (isRopeTaut) {
-				// Node N O[oSœꂽꍇÄʒuێ
-				ropeNodes[N] = lastFixedPoint;
-			}
-		}
-	}
+	// L[͂RAɓn (Xebv͐i߂Ȃ)
+	void Update(const InputState* input);
 
 	/**
 	 * @brief Rƃm[h`悵܂
+	 * @param snapshot `[h̏
+	 * @param batch Ɖ~߂ (`̂͌Ăяo Flush)
+	 * @param alpha O̕Xebv̕ԗ (0`1)
 	 */
-	void Draw() const {
-		if (ropeNodes.empty()) return;
+	void Draw(const WorldSnapshot& snapshot, PrimitiveBatch& batch, float alpha = 1.0f) const {
+		const SnapshotBody* ropeNodes = snapshot.Find(core);
+		if (ropeNodes == nullptr) return;
+		const int count = ropeNodes->count;
+		if (count == 0) return;
 
 		// 1. R () ̕`
 		// Node i  Node i+1 Ԑ`
-		for (size_t i = 0; i < ropeNodes.size() - 1; ++i) {
-			const Vec2f& p1 = ropeNodes[i];
-			const Vec2f& p2 = ropeNodes[i + 1];
-			DrawLine(
-				(int)p1.x,
-				(int)p1.y,
-				(int)p2.x,
-				(int)p2.y,
-				lineColor,
-				5
-			);
+		for (int i = 0; i < count - 1; ++i) {
+			const Vec2f p1 = snapshot.Interpolated(*ropeNodes, i, alpha);
+			const Vec2f p2 = snapshot.Interpolated(*ropeNodes, i + 1, alpha);
+			batch.AddLine(p1, p2, 5.0f, lineColor);
 		}
 
 		// 2. m[h̕`
-		for (size_t i = 0; i < ropeNodes.size(); ++i) {
-			unsigned int color = lineColor;
+		for (int i = 0; i < count; ++i) {
+			COLOR_U8 color = lineColor;
 			int smallRange = 5;
 			if (i == 0) {
 				color = controllableColor; // Node 0 (_)
 				smallRange = 0;
 			}
-			else if (i == ropeNodes.size() - 1) {
+			else if (i == count - 1) {
 				color = fixedColor; // Node N (Ǐ]_/Œ_)
 				smallRange = 0;
 			}
@@ -200,23 +76,10 @@ public:
 				//continue;
 			}
 
-			DrawCircle(
-				(int)ropeNodes[i].x,
-				(int)ropeNodes[i].y,
-				pointRadius - smallRange,
-				color,
-				TRUE
-			);
+			const Vec2f pos = snapshot.Interpolated(*ropeNodes, i, alpha);
+			batch.AddCircle(pos, (float)(pointRadius - smallRange), color);
 		}
 	}
-
-
-	// wp[֐: xNg𐳋K (1ɂ)
-	Vec2f normalize(const Vec2f& v) {
-		float len = v.length();
-		if (len == 0.0f) return { 0.0f, 0.0f };
-		return { v.x / len, v.y / len };
-	}
 };
 
 // --- gp (C[v) ---
@@ -228,21 +91,24 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	SetDrawScreen(DX_SCREEN_BACK);
 
 	// CX^X:
-	// n_(320, 100), m[h 10, ZOg 15, E 150, ړx 5.0
-	StringPointManager manager(320.0f, 100.0f, 10, 15.0f, 150.0f, 5.0f);
+	// n_(320, 100), m[h 10, ZOg 15, E 150, ړx 300 (pixels/s)
+	PhysicsWorld world;
+	StringPointManager manager(world, 320.0f, 100.0f, 10, 15.0f, 150.0f, 300.0f);
+	PrimitiveBatch batch;
 
 	// C[v
 	while (ProcessMessage() == 0 && CheckHitKey(KEY_INPUT_ESCAPE) == 0) {
 		ClearDrawScreen();
 
-		// 1. ͏
-		manager.handleInputAndUpdateControllablePoint();
-
-		// 2. R̍XV (݁EǏ])
-		manager.updateRope();
+		// 1. ͏ƕR̍XV (݁EǏ])
+		// input  GameManager::UpdateInputState Ɠ悤ɖt[XV InputState
+		manager.Update(&input);
+		world.Step(1.0f / 60.0f);
+		world.PublishSnapshot();
 
-		// 3. `
-		manager.draw();
+		// 2. `
+		manager.Draw(world.LatestSnapshot(), batch);
+		batch.Flush();
 
 		ScreenFlip();
 	}
@@ -0,0 +1,129 @@
+#include "TextLayoutCache.h"
+#include <cstdint>
+#include <cstring>
+
+namespace {
+	const int TABLE_SIZE = 256;							// 2ׂ̂
+	const int MAX_ENTRIES = TABLE_SIZE * 3 / 4;			// 𒴂ŜĂ (TZۂ)
+
+	struct Entry {
+		uint64_t hash = 0;
+		int fontHandle = 0;
+		int fontSize = 0;
+		int length = 0;
+		bool used = false;
+		TextLayoutCache::Extent extent = {};
+		int graph = -1;				// DrawStatic ō摜 (-1 Ȃ܂Ȃ)
+		unsigned int graphColor = 0;
+	};
+
+	Entry table[TABLE_SIZE];
+	int entryCount = 0;
+
+	uint64_t HashText(const char* text, int length) {
+		// FNV-1a
+		uint64_t hash = 14695981039346656037ull;
+		for (int i = 0; i < length; i++) {
+			hash = (hash ^ (unsigned char)text[i]) * 1099511628211ull;
+		}
+		return hash;
+	}
+
+	int FontSize(int fontHandle) {
+		return fontHandle == TextLayoutCache::DEFAULT_FONT ? GetFontSize() : GetFontSizeToHandle(fontHandle);
+	}
+
+	//sƂɑāAԒs̕ƑS̍s̍߂
+	TextLayoutCache::Extent MeasureText(int fontHandle, int fontSize, const char* text) {
+		const bool defaultFont = (fontHandle == TextLayoutCache::DEFAULT_FONT);
+		int width = 0;
+		int lines = 1;
+		const char* line = text;
+		for (;;) {
+			const char* end = std::strchr(line, '\n');
+			const int length = end ? (int)(end - line) : (int)std::strlen(line);
+			const int lineWidth = defaultFont
+				? GetDrawStringWidth(line, length)
+				: GetDrawStringWidthToHandle(line, length, fontHandle);
+			if (lineWidth > width) width = lineWidth;
+			if (end == nullptr) break;
+			line = end + 1;
+			lines++;
+		}
+		const int lineSpace = defaultFont ? GetFontLineSpace() : GetFontLineSpaceToHandle(fontHandle);
+		return { width, fontSize + lineSpace * (lines - 1) };
+	}
+
+	//(fontHandle, fontSize, text) ̏ꏊTAȂΑĒǉ
+	Entry& FindOrAdd(int fontHandle, const char* text) {
+		const int length = (int)std::strlen(text);
+		const int fontSize = FontSize(fontHandle);
+		const uint64_t hash = HashText(text, length)
+			^ ((uint64_t)(unsigned int)fontHandle << 32) ^ (uint64_t)fontSize;
+		int index = (int)(hash & (TABLE_SIZE - 1));
+		for (;;) {
+			Entry& e = table[index];
+			if (!e.used) break;
+			if (e.hash == hash && e.fontHandle == fontHandle && e.fontSize == fontSize && e.length == length) {
+				return e;
+			}
+			index = (index + 1) & (TABLE_SIZE - 1);
+		}
+
+		//t[ς镶łςɂȂAxŜĂĂ蒼
+		if (entryCount >= MAX_ENTRIES) {
+			TextLayoutCache::Clear();
+			index = (int)(hash & (TABLE_SIZE - 1));
+		}
+		Entry& e = table[index];
+		e.used = true;
+		e.hash = hash;
+		e.fontHandle = fontHandle;
+		e.fontSize = fontSize;
+		e.length = length;
+		e.extent = MeasureText(fontHandle, fontSize, text);
+		e.graph = -1;
+		entryCount++;
+		return e;
+	}
+}
+
+TextLayoutCache::Extent TextLayoutCache::Measure(int fontHandle, const char* text) {
+	return FindOrAdd(fontHandle, text).extent;
+}
+
+int TextLayoutCache::DrawStatic(int x, int y, int fontHandle, unsigned int color, const char* text) {
+	Entry& e = FindOrAdd(fontHandle, text);
+	if (e.extent.width <= 0 || e.extent.height <= 0) return 0;
+
+	if (e.graph < 0 || e.graphColor != color) {
+		if (e.graph >= 0) DeleteGraph(e.graph);
+		//ȉ摜Ɉx`Ă
+		e.graph = MakeScreen(e.extent.width, e.extent.height, TRUE);
+		e.graphColor = color;
+		if (e.graph < 0) {
+			return fontHandle == DEFAULT_FONT
+				? DrawString(x, y, text, color)
+				: DrawStringToHandle(x, y, text, color, fontHandle);
+		}
+		const int screen = GetDrawScreen();
+		SetDrawScreen(e.graph);
+		ClearDrawScreen();
+		if (fontHandle == DEFAULT_FONT) DrawString(0, 0, text, color);
+		else DrawStringToHandle(0, 0, text, color, fontHandle);
+		SetDrawScreen(screen);
+	}
+	return DrawGraph(x, y, e.graph, TRUE);
+}
+
+void TextLayoutCache::Clear() {
+	for (Entry& e : table) {
+		if (e.graph >= 0) DeleteGraph(e.graph);
+		e = Entry();
+	}
+	entryCount = 0;
+}
+
+int TextLayoutCache::EntryCount() {
+	return entryCount;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "DxLib.h"
+
+// `傫 (tHg, ̃nbV) ƂɊoĂLbV
+// t[ GetDrawStringWidthToHandle ő蒼Ȃ悤ɂB
+// ςȂ͉摜 (MakeScreen) Ɉx`ĂADrawStatic ł͓\邾ɂłB
+// DxLib ̕`ƓCXbh炾ĂԂ
+class TextLayoutCache {
+public:
+	// ̃tHg (SetFontSize ő傫ς͕̂ʂ̕ƂĊo)
+	static const int DEFAULT_FONT = -1;
+
+	struct Extent {
+		int width;		// Ԓs̕
+		int height;		// 1sڂ̏ォŌ̍s̉܂
+	};
+
+	// text  fontHandle ŕ`Ƃ̑傫 (߂Ă̑gݍ킹̂Ƃ)
+	static Extent Measure(int fontHandle, const char* text);
+	// text  (x, y) ɕ`B߂ĕ`Ƃɉ摜ɂĂA͂̉摜\
+	// (A`GCAX̃tHg͓ȉ摜ɕ`Ɖς̂ŁAʏ̃tHg)
+	static int DrawStatic(int x, int y, int fontHandle, unsigned int color, const char* text);
+
+	// oĂ傫Ɖ摜ׂĎ̂Ă (ςɂȂƂɂĂ΂)
+	static void Clear();
+	static int EntryCount();
+};
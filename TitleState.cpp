@@ -6,31 +6,34 @@
 
 void TitleState::Init() {
 	SetBackgroundColor(100, 100, 100);
-	//gp̃p\RɈꎞIFontǂݍ܂
-	AddFontResourceEx("Data/YDWaosagi.otf", FR_PRIVATE, 0);
-	m_titleFontHandle = CreateFontToHandle("YDW  R", 30, 3);
+	ResourceManager& resources = m_gameManager->Resources();
+	m_titleFont = resources.Acquire("font.title");
+	m_preload = resources.AcquireAll(InGameState::RESOURCES);
 }
 
-SceneTransition* TitleState::Update(const InputState* input, float deltaTime) {
+SceneTransition TitleState::Update(const InputState* input, float deltaTime, const FrameContext& frame) {
 
 	//SpaceƂ̓Q[V[ֈڍs
 	if (input->IsKeyDown(KEY_INPUT_SPACE)) {
-		SceneTransition* trans = new SceneTransition{ TransitionType::Change,
-			std::make_unique<InGameState>(m_gameManager) };
-		return trans;
+		return SceneTransition::ChangeTo(SceneId::InGame);
 	}
 
-	SceneTransition* trans = new SceneTransition{ TransitionType::None, nullptr };
-	return trans;
+	return {};
 }
 
 void TitleState::Draw() {
 	SetFontSize(30);
-	GameData::DrawStringWithAnchor(GameData::windowWidth / 2, GameData::windowHeight / 2,
-		0.5f, 0.5f, GetColor(255, 255, 255), "Space : Game Start");
+	GameData::DrawStaticStringWithAnchor(GameData::windowWidth / 2, GameData::windowHeight / 2,
+		0.5f, 0.5f, GetColor(255, 255, 255), TextLayoutCache::DEFAULT_FONT, "Space : Game Start");
 }
 
 void TitleState::Terminate() {
-	//ǂݍ܂tHgJ
-	RemoveFontResourceEx("Data/YDWaosagi.otf", FR_PRIVATE, 0);
-}
\ No newline at end of file
+	m_titleFont.Reset();
+	m_preload.clear();
+}
+
+int TitleState::Successors(SceneId* out, int maxCount) const {
+	if (maxCount < 1) return 0;
+	out[0] = SceneId::InGame;
+	return 1;
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include "IGameState.h"
+#include "ResourceManager.h"
+#include <vector>
 
 class GameManager;
 
@@ -9,10 +11,14 @@ public:
 	~TitleState() override = default;
 
 	void Init()override;
-	SceneTransition* Update(const InputState* input, float deltaTime)override;
+	SceneTransition Update(const InputState* input, float deltaTime, const FrameContext& frame)override;
 	void Draw()override;
 	void Terminate()override;
 
+	SceneId Id() const override { return SceneId::Title; }
+	int Successors(SceneId* out, int maxCount) const override;
+
 private:
-	int m_titleFontHandle;
+	ResourceRef m_titleFont;
+	std::vector<ResourceRef> m_preload;		// InGameState Ŏg (ɓǂݎn߂Ă)
 };
\ No newline at end of file